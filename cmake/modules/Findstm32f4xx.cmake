@@ -27,6 +27,7 @@ add_library(stm32f4xx EXCLUDE_FROM_ALL
     ${cmsis_device_f4_SOURCE_DIR}/Source/Templates/system_stm32f4xx.c
     ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal.c
     ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal_cortex.c
+    ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal_dma.c
     ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal_gpio.c
     ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal_rcc.c
     ${stm32f4xx_SOURCE_DIR}/Src/stm32f4xx_hal_uart.c
@@ -0,0 +1,274 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/init.hpp"
+
+#include <platform/console.hpp>
+#include <platform/main.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t cWriters = 4;
+constexpr std::size_t cMessages = 2000;
+constexpr std::size_t cPayloadSize = 40;
+constexpr std::size_t cHeaderSize = 9;
+constexpr std::size_t cMessageSize = cHeaderSize + cPayloadSize + 1;
+constexpr std::size_t cBufferSize = 1024;
+constexpr std::size_t cChunkSize = 64;
+
+using TestConsole = platform::StaticConsole<cBufferSize, cChunkSize>;
+
+// Emulated output device. Transmission is started by the console (only one at a time) and completed by the driver
+// thread, which plays the role of the transmit complete interrupt.
+TestConsole* console{};
+std::string output;
+std::atomic<bool> transmitPending{};
+std::atomic<bool> driverRunning{};
+
+/// Starts the emulated transmission: the chunk is appended to the output and completed later by the driver thread.
+bool transmit(const std::uint8_t* data, std::size_t size)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    output.append(reinterpret_cast<const char*>(data), size);
+    transmitPending.store(true, std::memory_order_release);
+    return true;
+}
+
+/// Yields the CPU while writer or flush() waits for the transmission.
+void yield()
+{
+    std::this_thread::yield();
+}
+
+/// Emulates the transmit complete interrupt.
+void driverThread()
+{
+    while (driverRunning.load(std::memory_order_acquire)) {
+        if (transmitPending.exchange(false, std::memory_order_acq_rel))
+            console->transmitDone();
+        else
+            std::this_thread::yield();
+    }
+}
+
+/// Returns message with the given sequence number of the given writer, e.g. "w2:00042:cccc...c\n".
+std::string makeMessage(std::size_t writer, std::size_t sequence)
+{
+    std::string message = "w" + std::to_string(writer) + ":" + std::to_string(sequence + 100000).substr(1) + ":";
+    message.append(cPayloadSize, static_cast<char>('a' + writer));
+    message.push_back('\n');
+    return message;
+}
+
+/// Writes all messages of one writer and counts the bytes accepted by the console.
+void writerThread(std::size_t writer, std::size_t& accepted)
+{
+    for (std::size_t i = 0; i < cMessages; ++i) {
+        auto message = makeMessage(writer, i);
+        accepted += console->write(message.data(), message.size());
+    }
+}
+
+/// Returns the name of the overflow policy.
+const char* policyName(platform::OverflowPolicy policy)
+{
+    switch (policy) {
+        case platform::OverflowPolicy::Drop: return "drop";
+        case platform::OverflowPolicy::Block: return "block";
+        case platform::OverflowPolicy::Overwrite: return "overwrite";
+    }
+
+    return "unknown";
+}
+
+/// Checks if the text matches the message of the given writer at the given position, with any sequence number.
+bool matchesMessage(std::string_view text, std::size_t writer, std::size_t position)
+{
+    auto expected = makeMessage(writer, 0);
+    for (std::size_t i = 0; i < text.size(); ++i, ++position) {
+        bool isSequenceDigit = position >= 3 && position < cHeaderSize - 1;
+        if (isSequenceDigit ? (text[i] < '0' || text[i] > '9') : text[i] != expected[position])
+            return false;
+    }
+
+    return true;
+}
+
+/// Checks if the text is a beginning of a message of any writer.
+bool isMessagePrefix(std::string_view text)
+{
+    if (text.empty())
+        return true;
+
+    auto writer = static_cast<std::size_t>(text.size() > 1 ? text[1] - '0' : 0);
+    return writer < cWriters && text.size() < cMessageSize && matchesMessage(text, writer, 0);
+}
+
+/// Checks if the text is an end of a message of any writer (without the trailing newline).
+bool isMessageSuffix(std::string_view text)
+{
+    if (text.empty())
+        return true;
+
+    auto writer = static_cast<std::size_t>(text.back() - 'a');
+    auto position = cMessageSize - 1 - std::min(text.size(), cMessageSize - 1);
+    return writer < cWriters && text.size() < cMessageSize && matchesMessage(text, writer, position);
+}
+
+/// Checks if the line is a beginning of one message followed by an end of another one.
+/// @note Overwrite policy discards the oldest bytes regardless of message boundaries, so a message which was partially
+/// transmitted can lose its end and the first message after the discarded data can lose its beginning. Data is only
+/// committed in whole messages and the rest of a message always fits into one chunk, so there is at most one such cut
+/// in a line. Bytes of different writes mixed in any other way are an error.
+bool isCutMessage(std::string_view line)
+{
+    for (std::size_t split = 0; split <= line.size(); ++split) {
+        if (isMessagePrefix(line.substr(0, split)) && isMessageSuffix(line.substr(split)))
+            return true;
+    }
+
+    return false;
+}
+
+/// Checks that the output consists of complete messages, in order of every writer and with no interleaving. With the
+/// block policy all messages have to be present.
+bool checkOutput(platform::OverflowPolicy policy)
+{
+    std::array<std::size_t, cWriters> received{};
+    std::array<long, cWriters> last{};
+    last.fill(-1);
+
+    if (!output.empty() && output.back() != '\n')
+        return false;
+
+    std::string_view rest = output;
+    while (!rest.empty()) {
+        auto end = rest.find('\n');
+        auto line = rest.substr(0, end);
+        rest.remove_prefix(end + 1);
+
+        auto writer = static_cast<std::size_t>(line.size() > 1 ? line[1] - '0' : cWriters);
+        auto sequence = line.size() == cMessageSize - 1 && writer < cWriters
+                          ? std::strtol(std::string{line.substr(3, cHeaderSize - 4)}.c_str(), nullptr, 10)
+                          : -1;
+        if (sequence >= 0 && std::string{line} + '\n' == makeMessage(writer, static_cast<std::size_t>(sequence))) {
+            if (sequence <= last.at(writer))
+                return false;
+
+            last.at(writer) = sequence;
+            ++received.at(writer);
+            continue;
+        }
+
+        if (policy != platform::OverflowPolicy::Overwrite || !isCutMessage(line))
+            return false;
+    }
+
+    if (policy == platform::OverflowPolicy::Block) {
+        for (auto count : received) {
+            if (count != cMessages)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/// Writes messages from several threads concurrently, flushes the console and checks the transmitted data.
+bool checkConsole(platform::OverflowPolicy policy)
+{
+    std::cout << "Console check (" << policyName(policy) << " policy, " << cWriters << " writers): ";
+
+    TestConsole testConsole(transmit, policy, yield);
+    console = &testConsole;
+    output.clear();
+    transmitPending.store(false);
+    driverRunning.store(true);
+    std::thread driver(driverThread);
+
+    std::array<std::size_t, cWriters> accepted{};
+    std::vector<std::thread> writers;
+    for (std::size_t i = 0; i < cWriters; ++i)
+        writers.emplace_back(writerThread, i, std::ref(accepted.at(i)));
+
+    for (auto& writer : writers)
+        writer.join();
+
+    testConsole.flush();
+    driverRunning.store(false, std::memory_order_release);
+    driver.join();
+
+    std::size_t total = cWriters * cMessages * cMessageSize;
+    std::size_t acceptedTotal = 0;
+    for (auto bytes : accepted)
+        acceptedTotal += bytes;
+
+    auto stats = testConsole.stats();
+    bool result = testConsole.pending() == 0 && checkOutput(policy) && stats.written == acceptedTotal
+               && stats.written + stats.dropped == total && stats.transmitted == output.size()
+               && stats.written == stats.transmitted + stats.overwritten && stats.peakUsage <= cBufferSize;
+
+    if (policy == platform::OverflowPolicy::Block)
+        result = result && acceptedTotal == total && stats.dropped == 0 && stats.overwritten == 0;
+    if (policy == platform::OverflowPolicy::Drop)
+        result = result && stats.overwritten == 0;
+
+    std::cout << (result ? "OK" : "FAILED") << " (transmitted " << stats.transmitted << ", dropped " << stats.dropped
+              << ", overwritten " << stats.overwritten << " bytes)\n";
+    return result;
+}
+
+} // namespace
+
+int appMain([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    if (!platform::init())
+        return EXIT_FAILURE;
+
+    for (auto policy :
+         {platform::OverflowPolicy::Drop, platform::OverflowPolicy::Block, platform::OverflowPolicy::Overwrite}) {
+        if (!checkConsole(policy))
+            return EXIT_FAILURE;
+    }
+
+    std::cout << "PASSED\n";
+    return EXIT_SUCCESS;
+}
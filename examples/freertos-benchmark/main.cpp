@@ -0,0 +1,1262 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/init.hpp"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/stream_buffer.h>
+#include <freertos/task.h>
+#include <freertos/timers.h>
+#include <platform/arena.hpp>
+#include <platform/main.hpp>
+#include <platform/memory.hpp>
+#include <platform/notify.hpp>
+#include <platform/pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+namespace {
+
+constexpr int cIterations = 2000;
+constexpr UBaseType_t cAppPriority = tskIDLE_PRIORITY + 1;
+constexpr std::size_t cStackSize = configMINIMAL_STACK_SIZE;
+constexpr std::size_t cMaxSleepers = 256;
+constexpr TickType_t cSleepTicks = portMAX_DELAY / 4;
+constexpr TickType_t cResponderTimeout = portMAX_DELAY / 2;
+constexpr TickType_t cMutexCheckTimeout = pdMS_TO_TICKS(10);
+constexpr std::size_t cMaxTimers = 1024;
+constexpr TickType_t cTimerPeriod = portMAX_DELAY / 4;
+constexpr std::uint32_t cFrames = 200000;
+constexpr UBaseType_t cQueueLength = 32;
+constexpr std::size_t cBatchSize = 8;
+constexpr std::size_t cMaxHeapBlocks = 1024;
+constexpr std::size_t cMinHeapBlockSize = 16;
+constexpr std::size_t cMaxHeapBlockSize = 256;
+constexpr std::size_t cScratchBuffers = 8;
+constexpr std::size_t cArenaSize = cScratchBuffers * cMaxHeapBlockSize * 2;
+constexpr std::size_t cMaxEventWaiters = 64;
+constexpr EventBits_t cProbeBit = 1U << 0U;
+constexpr EventBits_t cUnwaitedBit = 1U << 1U;
+constexpr unsigned int cFirstWaiterBit = 2;
+constexpr unsigned int cEventBits = (configUSE_16_BIT_TICKS == 1) ? 8 : 24;
+constexpr std::size_t cMaxCheckedCopySize = 80;
+constexpr std::size_t cCopyGuardSize = 8;
+constexpr std::uint8_t cCopyGuard = 0xa5;
+constexpr std::size_t cStreamBufferSize = 61;
+constexpr std::size_t cMaxStreamChunk = 23;
+constexpr UBaseType_t cCheckedQueueLength = 5;
+constexpr std::size_t cMaxCheckedBatch = 7;
+constexpr int cCheckRounds = 1000;
+constexpr std::uint32_t cPooledFrames = 4;
+constexpr std::size_t cPooledBlocks = 2;
+
+/// Message passed through the queue in the throughput benchmark.
+struct Frame {
+    std::uint32_t sequence;
+    std::array<std::uint8_t, 252> payload{};
+};
+
+static_assert(sizeof(Frame) == 256);
+
+/// Queue API used to pass frames in the throughput benchmark.
+enum class QueueApi {
+    eCopy,
+    eLoan,
+    eBatch
+};
+
+/// Shared state of the producer and consumer tasks in the queue throughput benchmark.
+struct QueueBenchmark {
+    QueueHandle_t queue;
+    TaskHandle_t owner;
+    QueueApi api;
+    bool valid;
+};
+
+/// Pool of frames used in the object pool check.
+using FramePool = platform::ObjectPool<Frame, cPooledFrames>;
+
+/// Shared state of the object pool check and the task waiting for a frame from the exhausted pool.
+struct PoolCheck {
+    FramePool* pool;
+    TaskHandle_t owner;
+    bool received;
+};
+
+/// Parameters and results of the notification based mutex check.
+struct MutexCheck {
+    platform::NotifyMutex* mutex;
+    TaskHandle_t owner;
+    bool timedOut;
+    bool locked;
+};
+
+/// Returns name of the ready task selection method compiled into the kernel.
+const char* taskSelectionName()
+{
+#if configUSE_PRIORITY_BITMAP_TASK_SELECTION
+    return "priority bitmap";
+#elif configUSE_PORT_OPTIMISED_TASK_SELECTION
+    return "port optimised";
+#else
+    return "generic";
+#endif
+}
+
+/// Event group and bits waited for by one task in the event group benchmark.
+struct EventWaiter {
+    EventGroupHandle_t group;
+    EventBits_t bits;
+};
+
+/// Returns name of the delayed tasks list implementation compiled into the kernel.
+const char* delayedListName()
+{
+#if configUSE_DELAYED_LIST_TIMING_WHEEL
+    return "timing wheel";
+#else
+    return "sorted list";
+#endif
+}
+
+/// Packs number of ticks into the task parameter.
+void* toParameter(TickType_t ticks)
+{
+    return reinterpret_cast<void*>(static_cast<std::uintptr_t>(ticks));
+}
+
+/// Unpacks number of ticks from the task parameter.
+TickType_t fromParameter(void* parameter)
+{
+    return static_cast<TickType_t>(reinterpret_cast<std::uintptr_t>(parameter));
+}
+
+/// Returns name of the active timers list implementation compiled into the kernel.
+const char* timerListName()
+{
+#if configUSE_TIMER_LIST_HEAP
+    return "heap";
+#elif configUSE_TIMER_LIST_TIMING_WHEEL
+    return "timing wheel";
+#else
+    return "sorted list";
+#endif
+}
+
+/// Fills the frame with data derived from its sequence number.
+/// @param frame            Frame to be filled.
+/// @param sequence         Sequence number of the frame.
+void fillFrame(Frame& frame, std::uint32_t sequence)
+{
+    frame.sequence = sequence;
+    std::memset(frame.payload.data(), static_cast<int>(sequence & 0xff), frame.payload.size());
+}
+
+/// Checks if the frame contains data filled by fillFrame() for the given sequence number.
+/// @param frame            Frame to be checked.
+/// @param sequence         Expected sequence number of the frame.
+/// @return True if the frame is valid, false otherwise.
+bool checkFrame(const Frame& frame, std::uint32_t sequence)
+{
+    return frame.sequence == sequence && frame.payload.front() == (sequence & 0xff)
+        && frame.payload.back() == (sequence & 0xff);
+}
+
+/// Task which posts cFrames frames to the queue using the selected queue API.
+/// @param parameter        Pointer to the QueueBenchmark state.
+void producerThread(void* parameter)
+{
+    static std::array<Frame, cBatchSize> batch{};
+    auto* benchmark = static_cast<QueueBenchmark*>(parameter);
+
+    for (std::uint32_t i = 0; i < cFrames;) {
+        switch (benchmark->api) {
+            case QueueApi::eCopy: {
+                Frame frame{};
+                fillFrame(frame, i);
+                xQueueSend(benchmark->queue, &frame, portMAX_DELAY);
+                ++i;
+                break;
+            }
+            case QueueApi::eLoan: {
+                void* slot{};
+                xQueueAcquireSendSlot(benchmark->queue, &slot, portMAX_DELAY);
+                fillFrame(*static_cast<Frame*>(slot), i);
+                xQueueCommitSend(benchmark->queue);
+                ++i;
+                break;
+            }
+            case QueueApi::eBatch: {
+                std::size_t count = std::min<std::size_t>(cBatchSize, cFrames - i);
+                for (std::size_t j = 0; j < count; ++j)
+                    fillFrame(batch[j], i + j);
+
+                for (std::size_t sent = 0; sent < count;)
+                    sent += xQueueSendMultiple(benchmark->queue, &batch[sent], count - sent, portMAX_DELAY);
+
+                i += count;
+                break;
+            }
+        }
+    }
+
+    xTaskNotifyGive(benchmark->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Task which receives cFrames frames from the queue using the selected queue API.
+/// @param parameter        Pointer to the QueueBenchmark state.
+void consumerThread(void* parameter)
+{
+    static std::array<Frame, cBatchSize> batch{};
+    auto* benchmark = static_cast<QueueBenchmark*>(parameter);
+
+    for (std::uint32_t i = 0; i < cFrames;) {
+        switch (benchmark->api) {
+            case QueueApi::eCopy: {
+                Frame frame{};
+                xQueueReceive(benchmark->queue, &frame, portMAX_DELAY);
+                if (!checkFrame(frame, i++))
+                    benchmark->valid = false;
+
+                break;
+            }
+            case QueueApi::eLoan: {
+                void* slot{};
+                xQueueAcquireReceiveSlot(benchmark->queue, &slot, portMAX_DELAY);
+                if (!checkFrame(*static_cast<const Frame*>(slot), i++))
+                    benchmark->valid = false;
+
+                xQueueReleaseReceive(benchmark->queue);
+                break;
+            }
+            case QueueApi::eBatch: {
+                auto count = xQueueReceiveMultiple(benchmark->queue, batch.data(), batch.size(), portMAX_DELAY);
+                for (BaseType_t j = 0; j < count; ++j) {
+                    if (!checkFrame(batch[j], i++))
+                        benchmark->valid = false;
+                }
+
+                break;
+            }
+        }
+    }
+
+    xTaskNotifyGive(benchmark->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Task which wakes up on each notification and immediately blocks again.
+/// @param timeout          Timeout of the blocking call packed with toParameter().
+void responderThread(void* timeout)
+{
+    while (true)
+        ulTaskNotifyTake(pdTRUE, fromParameter(timeout));
+}
+
+/// Task which waits for a frame from the exhausted pool and returns it immediately.
+/// @param parameter        Pointer to the PoolCheck.
+void poolWaiterThread(void* parameter)
+{
+    auto* check = static_cast<PoolCheck*>(parameter);
+    auto frame = check->pool->make(portMAX_DELAY, cPooledFrames);
+    check->received = frame && frame->sequence == cPooledFrames;
+    frame.reset();
+
+    xTaskNotifyGive(check->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Task which locks the mutex held by the check owner with a notification already pending (as left by a notification
+/// based semaphore), first with a timeout and then without it.
+/// @param parameter        Pointer to the MutexCheck.
+void mutexLockerThread(void* parameter)
+{
+    auto* check = static_cast<MutexCheck*>(parameter);
+    auto* self = xTaskGetCurrentTaskHandle();
+
+    xTaskNotifyGive(self);
+    check->timedOut = !check->mutex->lock(cMutexCheckTimeout) && check->mutex->owner() == check->owner;
+    xTaskNotifyGive(check->owner);
+
+    xTaskNotifyGive(self);
+    check->locked = check->mutex->lock() && check->mutex->owner() == self;
+    if (check->mutex->owner() == self)
+        check->mutex->unlock();
+
+    xTaskNotifyGive(check->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Task which stays in the delayed tasks list for the whole benchmark.
+/// @param ticks            Number of ticks to sleep packed with toParameter().
+void sleeperThread(void* ticks)
+{
+    while (true)
+        vTaskDelay(fromParameter(ticks));
+}
+
+/// Measures average round-trip time of notifying the given higher priority task and getting back the CPU after it
+/// blocks again.
+/// @param responder        Task to be notified.
+/// @return Average round-trip time in nanoseconds.
+std::int64_t measureRoundTrip(TaskHandle_t responder)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; ++i)
+        xTaskNotifyGive(responder);
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / cIterations;
+}
+
+/// Measures round-trip time of switching to the task with given priority and back to the calling task.
+/// @param priority         Priority of the responder task.
+/// @return Average round-trip time in nanoseconds.
+/// @note When responder blocks, the scheduler has to find the next ready task, which is (priority - cAppPriority)
+/// levels below. With the generic task selection this search is linear in the distance between priorities.
+std::int64_t measureSwitchLatency(UBaseType_t priority)
+{
+    static StaticTask_t taskBuffer{};
+    static std::array<StackType_t, cStackSize> stack{};
+
+    auto* responder = xTaskCreateStatic(responderThread,
+                                        "responder",
+                                        stack.size(),
+                                        toParameter(portMAX_DELAY),
+                                        priority,
+                                        stack.data(),
+                                        &taskBuffer);
+    if (responder == nullptr)
+        return -1;
+
+    auto latency = measureRoundTrip(responder);
+    vTaskDelete(responder);
+    return latency;
+}
+
+/// Measures context switch latency for all available priorities above the calling task.
+bool benchmarkSwitchLatency()
+{
+    std::cout << "Context switch latency (" << taskSelectionName() << " task selection, " << configMAX_PRIORITIES
+              << " priorities):\n";
+    std::cout << "    priority    round-trip [ns]\n";
+
+    for (UBaseType_t priority = cAppPriority + 1; priority < configMAX_PRIORITIES; ++priority) {
+        auto latency = measureSwitchLatency(priority);
+        if (latency < 0)
+            return false;
+
+        std::cout << "    " << priority << "\t\t" << latency << "\n";
+    }
+
+    return true;
+}
+
+/// Measures block/unblock latency of a task blocking with timeout for increasing number of delayed tasks.
+/// @note The timeout of the responder is longer than the delays of all sleepers, so with the sorted delayed list every
+/// block has to walk over all sleeping tasks.
+bool benchmarkBlockLatency()
+{
+    static std::array<StaticTask_t, cMaxSleepers> sleeperBuffers{};
+    static std::array<std::array<StackType_t, cStackSize>, cMaxSleepers> sleeperStacks{};
+    static std::array<TaskHandle_t, cMaxSleepers> sleepers{};
+    static StaticTask_t responderBuffer{};
+    static std::array<StackType_t, cStackSize> responderStack{};
+
+    std::cout << "Block with timeout latency (" << delayedListName() << " delayed tasks list):\n";
+    std::cout << "    sleeping    round-trip [ns]\n";
+
+    auto* responder = xTaskCreateStatic(responderThread,
+                                        "responder",
+                                        responderStack.size(),
+                                        toParameter(cResponderTimeout),
+                                        cAppPriority + 2,
+                                        responderStack.data(),
+                                        &responderBuffer);
+    if (responder == nullptr)
+        return false;
+
+    bool result = true;
+    std::size_t sleepersCount = 0;
+    for (std::size_t count : {0U, 16U, 64U, 256U}) {
+        for (; sleepersCount < count; ++sleepersCount) {
+            sleepers[sleepersCount] = xTaskCreateStatic(sleeperThread,
+                                                        "sleeper",
+                                                        cStackSize,
+                                                        toParameter(cSleepTicks + sleepersCount),
+                                                        cAppPriority + 1,
+                                                        sleeperStacks[sleepersCount].data(),
+                                                        &sleeperBuffers[sleepersCount]);
+            if (sleepers[sleepersCount] == nullptr) {
+                result = false;
+                break;
+            }
+        }
+
+        if (!result)
+            break;
+
+        std::cout << "    " << count << "\t\t" << measureRoundTrip(responder) << "\n";
+    }
+
+    for (std::size_t i = 0; i < sleepersCount; ++i)
+        vTaskDelete(sleepers[i]);
+
+    vTaskDelete(responder);
+    return result;
+}
+
+/// Measures latency of resetting a software timer for increasing number of active timers.
+/// @note Timer commands are processed by the timer service task, which has higher priority than the calling task, so
+/// each reset includes switching to the timer service task and back. The reset timer always expires last, so with the
+/// sorted active timers list every reset has to walk over all active timers.
+bool benchmarkTimerResetLatency()
+{
+    static std::array<StaticTimer_t, cMaxTimers> timerBuffers{};
+    static std::array<TimerHandle_t, cMaxTimers> timers{};
+    static StaticTimer_t probeBuffer{};
+
+    std::cout << "Timer reset latency (" << timerListName() << " active timers list):\n";
+    std::cout << "    active      round-trip [ns]\n";
+
+    auto callback = [](TimerHandle_t /*unused*/) {};
+    auto* probe = xTimerCreateStatic("probe", cTimerPeriod, pdFALSE, nullptr, callback, &probeBuffer);
+    if (probe == nullptr)
+        return false;
+
+    bool result = true;
+    std::size_t timersCount = 0;
+    for (std::size_t count : {0U, 64U, 256U, 1024U}) {
+        for (; timersCount < count; ++timersCount) {
+            timers[timersCount] = xTimerCreateStatic("timer",
+                                                     cTimerPeriod,
+                                                     pdFALSE,
+                                                     nullptr,
+                                                     callback,
+                                                     &timerBuffers[timersCount]);
+            if (timers[timersCount] == nullptr || xTimerStart(timers[timersCount], portMAX_DELAY) != pdPASS) {
+                result = false;
+                break;
+            }
+        }
+
+        if (!result)
+            break;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < cIterations; ++i)
+            xTimerReset(probe, portMAX_DELAY);
+
+        auto end = std::chrono::steady_clock::now();
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / cIterations;
+        std::cout << "    " << count << "\t\t" << latency << "\n";
+    }
+
+    for (std::size_t i = 0; i < timersCount; ++i) {
+        xTimerStop(timers[i], portMAX_DELAY);
+        xTimerDelete(timers[i], portMAX_DELAY);
+    }
+
+    xTimerStop(probe, portMAX_DELAY);
+    xTimerDelete(probe, portMAX_DELAY);
+    return result;
+}
+
+/// Returns average time of the given operation.
+/// @param operation        Operation to be measured.
+/// @return Average time in nanoseconds.
+std::int64_t measureAverage(auto operation)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; ++i)
+        operation();
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / cIterations;
+}
+
+/// Task which waits for the semaphore given by the benchmark and immediately waits again.
+/// @param semaphore        Queue based binary semaphore.
+void semaphoreResponderThread(void* semaphore)
+{
+    while (true)
+        xSemaphoreTake(static_cast<SemaphoreHandle_t>(semaphore), portMAX_DELAY);
+}
+
+/// Task which waits for the notification based semaphore given by the benchmark and immediately waits again.
+/// @param semaphore        Notification based binary semaphore, which becomes owned by this task.
+void notifyResponderThread(void* semaphore)
+{
+    auto* notifySemaphore = static_cast<platform::NotifySemaphore*>(semaphore);
+    notifySemaphore->setOwner(xTaskGetCurrentTaskHandle());
+    while (true)
+        notifySemaphore->take();
+}
+
+/// Measures average time of waking up a higher priority task waiting for the semaphore and getting back the CPU after
+/// it waits again.
+/// @param function         Task function of the responder.
+/// @param parameter        Semaphore passed to the responder.
+/// @param give             Gives the semaphore.
+/// @return Average round-trip time in nanoseconds or -1 on error.
+std::int64_t measureWakeUp(TaskFunction_t function, void* parameter, auto give)
+{
+    static StaticTask_t taskBuffer{};
+    static std::array<StackType_t, cStackSize> stack{};
+
+    auto* responder = xTaskCreateStatic(function,
+                                        "responder",
+                                        stack.size(),
+                                        parameter,
+                                        cAppPriority + 1,
+                                        stack.data(),
+                                        &taskBuffer);
+    if (responder == nullptr)
+        return -1;
+
+    auto latency = measureAverage(give);
+    vTaskDelete(responder);
+    return latency;
+}
+
+/// Compares the notification based primitives with the queue based ones.
+/// @note Give and take pair and lock and unlock pair are made by the calling task without blocking, so they show the
+/// cost of the primitives alone. Wake-up includes two context switches.
+bool benchmarkSignalling()
+{
+    static StaticSemaphore_t semaphoreBuffer{};
+    static StaticSemaphore_t mutexBuffer{};
+    static platform::NotifySemaphore notifySemaphore;
+    static platform::NotifyMutex notifyMutex;
+
+    auto* semaphore = xSemaphoreCreateBinaryStatic(&semaphoreBuffer);
+    auto* mutex = xSemaphoreCreateMutexStatic(&mutexBuffer);
+    if (semaphore == nullptr || mutex == nullptr)
+        return false;
+
+    notifySemaphore.setOwner(xTaskGetCurrentTaskHandle());
+    auto semaphoreGiveTake = measureAverage([&] {
+        xSemaphoreGive(semaphore);
+        xSemaphoreTake(semaphore, 0);
+    });
+    auto notifyGiveTake = measureAverage([&] {
+        notifySemaphore.give();
+        notifySemaphore.take(0);
+    });
+    auto mutexLockUnlock = measureAverage([&] {
+        xSemaphoreTake(mutex, 0);
+        xSemaphoreGive(mutex);
+    });
+    auto notifyLockUnlock = measureAverage([&] {
+        notifyMutex.lock(0);
+        notifyMutex.unlock();
+    });
+    auto semaphoreWakeUp = measureWakeUp(semaphoreResponderThread, semaphore, [&] { xSemaphoreGive(semaphore); });
+    auto notifyWakeUp = measureWakeUp(notifyResponderThread, &notifySemaphore, [&] { notifySemaphore.give(); });
+
+    vSemaphoreDelete(semaphore);
+    vSemaphoreDelete(mutex);
+    if (semaphoreWakeUp < 0 || notifyWakeUp < 0)
+        return false;
+
+    std::cout << "Signalling latency (queue based vs notification based primitives):\n";
+    std::cout << "    operation   queue [ns]  notification [ns]\n";
+    std::cout << "    give/take\t" << semaphoreGiveTake << "\t\t" << notifyGiveTake << "\n";
+    std::cout << "    lock/unlock\t" << mutexLockUnlock << "\t\t" << notifyLockUnlock << "\n";
+    std::cout << "    wake-up\t" << semaphoreWakeUp << "\t\t" << notifyWakeUp << "\n";
+    return true;
+}
+
+/// Returns name of the event group waiters structure compiled into the kernel.
+const char* eventGroupWaitersName()
+{
+#if configUSE_EVENT_GROUP_WAITER_INDEX
+    return "waiter index";
+#else
+    return "waiter list";
+#endif
+}
+
+/// Task which waits for any of the given event bits, clearing them on exit, and immediately waits again.
+/// @param waiter           Event group and bits to wait for.
+void eventWaiterThread(void* waiter)
+{
+    const auto* eventWaiter = static_cast<const EventWaiter*>(waiter);
+    while (true)
+        xEventGroupWaitBits(eventWaiter->group, eventWaiter->bits, pdTRUE, pdFALSE, portMAX_DELAY);
+}
+
+/// Measures latency of setting event group bits for increasing number of tasks waiting for other bits of the group.
+/// @note Set only wakes up the probe task waiting for its bit (round-trip including two context switches) or no task at
+/// all. With the waiter list every set has to test the wait condition of all waiting tasks.
+bool benchmarkEventGroupLatency()
+{
+    static std::array<StaticTask_t, cMaxEventWaiters + 1> waiterBuffers{};
+    static std::array<std::array<StackType_t, cStackSize>, cMaxEventWaiters + 1> waiterStacks{};
+    static std::array<TaskHandle_t, cMaxEventWaiters + 1> waiters{};
+    static std::array<EventWaiter, cMaxEventWaiters + 1> waiterParameters{};
+    static StaticEventGroup_t groupBuffer{};
+
+    auto* group = xEventGroupCreateStatic(&groupBuffer);
+    if (group == nullptr)
+        return false;
+
+    std::cout << "Event group set bits latency (" << eventGroupWaitersName() << "):\n";
+    std::cout << "    waiting     no wake-up [ns] wake-up [ns]\n";
+
+    // The first waiter is the probe, the others wait for all the remaining bits in turn.
+    bool result = true;
+    std::size_t waitersCount = 0;
+    for (std::size_t count : {0U, 8U, 32U, 64U}) {
+        for (; waitersCount <= count; ++waitersCount) {
+            auto bit = cFirstWaiterBit + (waitersCount % (cEventBits - cFirstWaiterBit));
+            waiterParameters[waitersCount] = {group, (waitersCount == 0) ? cProbeBit : EventBits_t{1U} << bit};
+            waiters[waitersCount] = xTaskCreateStatic(eventWaiterThread,
+                                                      "waiter",
+                                                      cStackSize,
+                                                      &waiterParameters[waitersCount],
+                                                      cAppPriority + 1,
+                                                      waiterStacks[waitersCount].data(),
+                                                      &waiterBuffers[waitersCount]);
+            if (waiters[waitersCount] == nullptr) {
+                result = false;
+                break;
+            }
+        }
+
+        if (!result)
+            break;
+
+        auto noWakeUp = measureAverage([&] {
+            xEventGroupSetBits(group, cUnwaitedBit);
+            xEventGroupClearBits(group, cUnwaitedBit);
+        });
+        auto wakeUp = measureAverage([&] { xEventGroupSetBits(group, cProbeBit); });
+        if ((xEventGroupGetBits(group) & cProbeBit) != 0) {
+            result = false;
+            break;
+        }
+
+        std::cout << "    " << count << "\t\t" << noWakeUp << "\t\t" << wakeUp << "\n";
+    }
+
+    for (std::size_t i = 0; i < waitersCount; ++i)
+        vTaskDelete(waiters[i]);
+
+    vEventGroupDelete(group);
+    return result;
+}
+
+/// Returns byte of the test pattern at the given position of the stream.
+std::uint8_t streamPattern(std::size_t position)
+{
+    return static_cast<std::uint8_t>((position * 7) + (position >> 8));
+}
+
+/// Checks the zero-copy stream buffer API: xStreamBufferReserve()/vStreamBufferCommit() and
+/// xStreamBufferPeek()/vStreamBufferConsume(), together with their FromISR variants.
+/// @note Writer and reader use chunks of different, varying sizes and the buffer size is not a multiple of any of them,
+/// so the spans wrap around the end of the storage area at all offsets. Each span must not cross the end of the
+/// storage area and the data must come out in the order it was written.
+bool checkStreamBufferSpans()
+{
+    static StaticStreamBuffer_t streamBufferBuffer{};
+    // Stream buffer needs one byte more than its capacity.
+    static std::array<std::uint8_t, cStreamBufferSize + 1> storage{};
+
+    std::cout << "Stream buffer reserve/commit and peek/consume check (wraparound, task and ISR API): ";
+
+    auto* streamBuffer = xStreamBufferCreateStatic(cStreamBufferSize, 1, storage.data(), &streamBufferBuffer);
+    if (streamBuffer == nullptr) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+
+    auto inStorage = [&](const void* data, std::size_t size) {
+        const auto* begin = static_cast<const std::uint8_t*>(data);
+        return size > 0 && begin >= storage.data() && begin + size <= storage.data() + storage.size();
+    };
+
+    bool result = true;
+    std::size_t written = 0;
+    std::size_t read = 0;
+    for (int i = 0; i < cCheckRounds && result; ++i) {
+        bool fromIsr = (i % 2) != 0;
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+        // Write one chunk, splitting it if the free span ends at the end of the storage area.
+        std::size_t chunk = 1 + (static_cast<std::size_t>(i) * 5) % cMaxStreamChunk;
+        while (chunk > 0 && xStreamBufferSpacesAvailable(streamBuffer) > 0) {
+            void* data{};
+            auto size = fromIsr ? xStreamBufferReserveFromISR(streamBuffer, &data)
+                                : xStreamBufferReserve(streamBuffer, &data, 0);
+            if (!inStorage(data, size)) {
+                result = false;
+                break;
+            }
+
+            size = std::min(size, chunk);
+            for (std::size_t j = 0; j < size; ++j)
+                static_cast<std::uint8_t*>(data)[j] = streamPattern(written + j);
+
+            if (fromIsr)
+                vStreamBufferCommitFromISR(streamBuffer, size, &higherPriorityTaskWoken);
+            else
+                vStreamBufferCommit(streamBuffer, size);
+
+            written += size;
+            chunk -= size;
+        }
+
+        // Read a chunk of a different size, so the read position does not follow the write position.
+        chunk = 1 + (static_cast<std::size_t>(i) * 3) % cMaxStreamChunk;
+        while (result && chunk > 0 && xStreamBufferBytesAvailable(streamBuffer) > 0) {
+            void* data{};
+            auto size = fromIsr ? xStreamBufferPeekFromISR(streamBuffer, &data)
+                                : xStreamBufferPeek(streamBuffer, &data, 0);
+            if (!inStorage(data, size)) {
+                result = false;
+                break;
+            }
+
+            size = std::min(size, chunk);
+            for (std::size_t j = 0; j < size; ++j)
+                result = result && static_cast<const std::uint8_t*>(data)[j] == streamPattern(read + j);
+
+            if (fromIsr)
+                vStreamBufferConsumeFromISR(streamBuffer, size, &higherPriorityTaskWoken);
+            else
+                vStreamBufferConsume(streamBuffer, size);
+
+            read += size;
+            chunk -= size;
+        }
+
+        result = result && written - read == xStreamBufferBytesAvailable(streamBuffer);
+    }
+
+    // Full and empty buffer must not give any span.
+    void* data{};
+    while (result && xStreamBufferSpacesAvailable(streamBuffer) > 0)
+        result = xStreamBufferSend(streamBuffer, storage.data(), 1, 0) == 1;
+
+    result = result && xStreamBufferReserve(streamBuffer, &data, 0) == 0;
+    xStreamBufferReset(streamBuffer);
+    result = result && xStreamBufferPeek(streamBuffer, &data, 0) == 0 && written > 4 * cStreamBufferSize;
+
+    vStreamBufferDelete(streamBuffer);
+    std::cout << (result ? "OK\n" : "FAILED\n");
+    return result;
+}
+
+/// Checks the queue loan API: xQueueAcquireSendSlot()/xQueueCommitSend() and
+/// xQueueAcquireReceiveSlot()/xQueueReleaseReceive(), and the batch API: xQueueSendMultiple() and
+/// xQueueReceiveMultiple(), together with their FromISR variants.
+/// @note Batches are longer than the queue, so they are only partially posted and the queue storage wraps around at
+/// all offsets. Items must come out in the order they were posted, regardless of the API used on each side.
+bool checkQueueLoansAndBatches()
+{
+    static StaticQueue_t queueBuffer{};
+    static std::array<std::uint8_t, cCheckedQueueLength * sizeof(std::uint32_t)> queueStorage{};
+
+    std::cout << "Queue loan and batch check (wraparound, partial batches, task and ISR API): ";
+
+    auto* queue = xQueueCreateStatic(cCheckedQueueLength, sizeof(std::uint32_t), queueStorage.data(), &queueBuffer);
+    if (queue == nullptr) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+
+    bool result = true;
+    std::uint32_t sent = 0;
+    std::uint32_t received = 0;
+    std::array<std::uint32_t, cMaxCheckedBatch> batch{};
+    for (int i = 0; i < cCheckRounds && result; ++i) {
+        bool fromIsr = (i % 2) != 0;
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        auto count = 1 + (static_cast<std::size_t>(i) % cMaxCheckedBatch);
+        auto spaces = uxQueueSpacesAvailable(queue);
+
+        if ((i % 3) == 0) {
+            // Send through the loaned slot. While it is loaned, the queue appears full to other senders.
+            void* slot{};
+            if (xQueueAcquireSendSlot(queue, &slot, 0) == pdPASS) {
+                *static_cast<std::uint32_t*>(slot) = sent;
+                result = xQueueSend(queue, &sent, 0) == errQUEUE_FULL && xQueueCommitSend(queue) == pdPASS;
+                ++sent;
+            }
+            else {
+                result = spaces == 0;
+            }
+        }
+        else {
+            for (std::size_t j = 0; j < count; ++j)
+                batch[j] = sent + j;
+
+            auto posted = fromIsr ? xQueueSendMultipleFromISR(queue, batch.data(), count, &higherPriorityTaskWoken)
+                                  : xQueueSendMultiple(queue, batch.data(), count, 0);
+            result = static_cast<std::size_t>(posted) == std::min<std::size_t>(count, spaces);
+            sent += posted;
+        }
+
+        if ((i % 4) == 1) {
+            // Receive through the loaned slot.
+            void* slot{};
+            if (result && xQueueAcquireReceiveSlot(queue, &slot, 0) == pdPASS) {
+                result = *static_cast<const std::uint32_t*>(slot) == received && xQueueReleaseReceive(queue) == pdPASS;
+                ++received;
+            }
+        }
+        else if (result) {
+            batch.fill(0);
+            auto maxItems = 1 + (static_cast<std::size_t>(i) * 3) % cMaxCheckedBatch;
+            auto items = fromIsr ? xQueueReceiveMultipleFromISR(queue, batch.data(), maxItems, &higherPriorityTaskWoken)
+                                 : xQueueReceiveMultiple(queue, batch.data(), maxItems, 0);
+            for (BaseType_t j = 0; j < items; ++j)
+                result = result && batch[j] == received++;
+        }
+
+        result = result && sent - received == uxQueueMessagesWaiting(queue);
+    }
+
+    vQueueDelete(queue);
+    std::cout << (result ? "OK\n" : "FAILED\n");
+    return result;
+}
+
+/// Checks the object and block pools: exhausting the pool, allocation timeout, waking a task waiting for a free
+/// object, the ISR API and the pool statistics.
+bool checkPools()
+{
+    static FramePool framePool;
+    static platform::BlockPool<sizeof(std::uint32_t), cPooledBlocks> blockPool;
+    static StaticTask_t waiterBuffer{};
+    static std::array<StackType_t, cStackSize> waiterStack{};
+
+    std::cout << "Object pool check (exhaustion, timeout, waiting task, ISR API): ";
+
+    bool result = true;
+    std::array<FramePool::Ptr, cPooledFrames> frames;
+    for (std::uint32_t i = 0; i < cPooledFrames; ++i) {
+        frames[i] = framePool.make(0, i);
+        result = result && frames[i] && frames[i]->sequence == i;
+    }
+
+    result = result && framePool.available() == 0 && !framePool.make(0) && framePool.create(1) == nullptr;
+
+    // Waiter has higher priority, so it blocks on the exhausted pool right away. Returning a frame wakes it up.
+    PoolCheck check{&framePool, xTaskGetCurrentTaskHandle(), false};
+    auto* waiter = xTaskCreateStatic(poolWaiterThread,
+                                     "waiter",
+                                     cStackSize,
+                                     &check,
+                                     cAppPriority + 1,
+                                     waiterStack.data(),
+                                     &waiterBuffer);
+    if (waiter == nullptr) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+
+    frames[0].reset();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    vTaskDelete(waiter);
+
+    for (auto& frame : frames)
+        frame.reset();
+
+    auto stats = framePool.stats();
+    result = result && check.received && stats.uxBlocksAvailable == cPooledFrames && stats.uxMinimumEverAvailable == 0
+          && stats.uxAllocations == cPooledFrames + 1 && stats.uxFailedAllocations == 2;
+
+    std::array<void*, cPooledBlocks> blocks{};
+    for (auto& block : blocks) {
+        block = blockPool.allocateFromIsr();
+        result = result && block != nullptr;
+    }
+
+    result = result && blockPool.allocateFromIsr() == nullptr;
+    for (auto* block : blocks)
+        blockPool.freeFromIsr(block);
+
+    result = result && blockPool.available() == cPooledBlocks;
+    std::cout << (result ? "OK\n" : "FAILED\n");
+    return result;
+}
+
+/// Checks that the notification based mutex is locked only when it is handed over, even if a notification is already
+/// pending when the waiting starts: timeout while the mutex is held and handover on unlock.
+bool checkNotifyMutex()
+{
+    static platform::NotifyMutex mutex;
+    static StaticTask_t lockerBuffer{};
+    static std::array<StackType_t, cStackSize> lockerStack{};
+
+    std::cout << "Notification mutex check (pending notification, timeout, handover): ";
+
+    auto* self = xTaskGetCurrentTaskHandle();
+    bool result = mutex.lock(0);
+
+    // Locker has higher priority, so it tries to lock the mutex right away.
+    MutexCheck check{&mutex, self, false, false};
+    auto* locker = xTaskCreateStatic(mutexLockerThread,
+                                     "locker",
+                                     cStackSize,
+                                     &check,
+                                     cAppPriority + 1,
+                                     lockerStack.data(),
+                                     &lockerBuffer);
+    if (locker == nullptr) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+
+    // Locker has timed out and waits for the mutex again, so unlocking hands the mutex over to it.
+    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    result = result && mutex.owner() == self;
+    mutex.unlock();
+    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    vTaskDelete(locker);
+
+    result = result && check.timedOut && check.locked && mutex.owner() == nullptr;
+    std::cout << (result ? "OK\n" : "FAILED\n");
+    return result;
+}
+
+/// Checks copyMemory() and fillMemory() against the C library for all sizes up to cMaxCheckedCopySize and all
+/// combinations of source and destination alignments.
+/// @note On the host the functions are checked but not timed, as the C library there is not the byte by byte one of
+/// newlib-nano.
+bool checkMemoryFunctions()
+{
+    static std::array<std::uint8_t, cMaxCheckedCopySize + 4> source{};
+    static std::array<std::uint8_t, cMaxCheckedCopySize + 4 + 2 * cCopyGuardSize> destination{};
+    static std::array<std::uint8_t, cMaxCheckedCopySize + 4 + 2 * cCopyGuardSize> expected{};
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+        source[i] = static_cast<std::uint8_t>(i + 1);
+
+    std::cout << "Memory functions check (sizes 0-" << cMaxCheckedCopySize << ", all alignments): ";
+
+    for (std::size_t size = 0; size <= cMaxCheckedCopySize; ++size) {
+        for (std::size_t srcOffset = 0; srcOffset < 4; ++srcOffset) {
+            for (std::size_t dstOffset = cCopyGuardSize; dstOffset < cCopyGuardSize + 4; ++dstOffset) {
+                destination.fill(cCopyGuard);
+                expected.fill(cCopyGuard);
+                std::memcpy(&expected[dstOffset], &source[srcOffset], size);
+                if (platform::copyMemory(&destination[dstOffset], &source[srcOffset], size) != &destination[dstOffset]
+                    || destination != expected) {
+                    std::cout << "FAILED\n";
+                    return false;
+                }
+
+                auto value = static_cast<int>(size);
+                std::memset(&expected[dstOffset], value, size);
+                if (platform::fillMemory(&destination[dstOffset], value, size) != &destination[dstOffset]
+                    || destination != expected) {
+                    std::cout << "FAILED\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    std::cout << "OK\n";
+    return true;
+}
+
+/// Returns name of the given queue API.
+const char* queueApiName(QueueApi api)
+{
+    switch (api) {
+        case QueueApi::eCopy: return "copy";
+        case QueueApi::eLoan: return "loan";
+        case QueueApi::eBatch: return "batch";
+    }
+
+    return "unknown";
+}
+
+/// Measures throughput of passing frames between two tasks through the queue.
+/// @param api              Queue API used to pass the frames.
+/// @return Number of frames passed per second or -1 on error.
+/// @note Consumer has lower priority than producer, so it is woken up only when the queue gets full. This way the
+/// result is dominated by the cost of queue operations and not by context switches.
+std::int64_t measureQueueThroughput(QueueApi api)
+{
+    static StaticQueue_t queueBuffer{};
+    alignas(Frame) static std::array<std::uint8_t, cQueueLength * sizeof(Frame)> queueStorage{};
+    static std::array<StaticTask_t, 2> taskBuffers{};
+    static std::array<std::array<StackType_t, cStackSize>, 2> taskStacks{};
+
+    QueueBenchmark benchmark{};
+    benchmark.queue = xQueueCreateStatic(cQueueLength, sizeof(Frame), queueStorage.data(), &queueBuffer);
+    benchmark.owner = xTaskGetCurrentTaskHandle();
+    benchmark.api = api;
+    benchmark.valid = true;
+    if (benchmark.queue == nullptr)
+        return -1;
+
+    auto start = std::chrono::steady_clock::now();
+    auto* consumer = xTaskCreateStatic(consumerThread,
+                                       "consumer",
+                                       cStackSize,
+                                       &benchmark,
+                                       cAppPriority + 1,
+                                       taskStacks[0].data(),
+                                       &taskBuffers[0]);
+    auto* producer = xTaskCreateStatic(producerThread,
+                                       "producer",
+                                       cStackSize,
+                                       &benchmark,
+                                       cAppPriority + 2,
+                                       taskStacks[1].data(),
+                                       &taskBuffers[1]);
+    if (consumer == nullptr || producer == nullptr)
+        return -1;
+
+    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    auto end = std::chrono::steady_clock::now();
+
+    vTaskDelete(producer);
+    vTaskDelete(consumer);
+    vQueueDelete(benchmark.queue);
+    if (!benchmark.valid)
+        return -1;
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return static_cast<std::int64_t>(cFrames) * 1000000000 / duration;
+}
+
+/// Measures queue throughput with all available queue APIs.
+bool benchmarkQueueThroughput()
+{
+    std::cout << "Queue throughput (" << sizeof(Frame) << " byte frames, queue length " << cQueueLength << "):\n";
+    std::cout << "    api         frames/s\n";
+
+    for (auto api : {QueueApi::eCopy, QueueApi::eLoan, QueueApi::eBatch}) {
+        auto throughput = measureQueueThroughput(api);
+        if (throughput < 0)
+            return false;
+
+        std::cout << "    " << queueApiName(api) << "\t\t" << throughput << "\n";
+    }
+
+    return true;
+}
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+/// Latency statistics of a single heap operation.
+struct HeapLatency {
+    std::int64_t total;
+    std::int64_t max;
+};
+
+/// Measures the time of the given heap operation and updates its statistics.
+/// @param latency          Statistics to be updated.
+/// @param operation        Heap operation to be measured.
+/// @return Result of the operation.
+auto measureHeapOperation(HeapLatency& latency, auto operation)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto result = operation();
+    auto end = std::chrono::steady_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    latency.total += duration;
+    latency.max = std::max(latency.max, duration);
+    return result;
+}
+
+/// Measures latency of pvPortMalloc() and vPortFree() for increasing number of allocated blocks.
+/// @note Each iteration frees a random block and allocates a new one of random size in its place, so the heap gets
+/// fragmented the same way as in a long running application. With the first fit heap every operation has to walk over
+/// the free blocks, while with TLSF heap its time is bounded. Maximum includes the occasional preemption of the
+/// simulator thread by the host.
+bool benchmarkHeapLatency()
+{
+    static std::array<void*, cMaxHeapBlocks> blocks{};
+
+    std::cout << "Heap allocation latency (" << cMinHeapBlockSize << "-" << cMaxHeapBlockSize << " byte blocks):\n";
+    std::cout << "    allocated   malloc avg/max [ns]     free avg/max [ns]\n";
+
+    std::minstd_rand random;
+    std::uniform_int_distribution<std::size_t> sizes(cMinHeapBlockSize, cMaxHeapBlockSize);
+    std::uniform_int_distribution<std::size_t> indexes;
+    auto allocate = [&] { return pvPortMalloc(sizes(random)); };
+
+    bool result = true;
+    for (std::size_t count : {16U, 256U, 1024U}) {
+        for (std::size_t i = 0; i < count && result; ++i) {
+            blocks[i] = allocate();
+            result = blocks[i] != nullptr;
+        }
+
+        HeapLatency mallocLatency{};
+        HeapLatency freeLatency{};
+        for (int i = 0; i < cIterations && result; ++i) {
+            auto& block = blocks[indexes(random) % count];
+            measureHeapOperation(freeLatency, [&] {
+                vPortFree(block);
+                return true;
+            });
+            block = measureHeapOperation(mallocLatency, allocate);
+            result = block != nullptr;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            vPortFree(blocks[i]);
+            blocks[i] = nullptr;
+        }
+
+        if (!result)
+            break;
+
+        std::cout << "    " << count << "\t\t" << mallocLatency.total / cIterations << " / " << mallocLatency.max
+                  << "\t\t" << freeLatency.total / cIterations << " / " << freeLatency.max << "\n";
+    }
+
+    return result;
+}
+
+/// Measures time of allocating short-lived scratch buffers from the heap and from the arena.
+/// @note Each round allocates a few buffers of random size and releases all of them, like e.g. formatting a message.
+/// Heap buffers are freed one by one, while the arena is rewound once per round.
+bool benchmarkScratchAllocation()
+{
+    static platform::StaticArena<cArenaSize> arena;
+    std::array<void*, cScratchBuffers> buffers{};
+
+    std::cout << "Scratch allocation latency (" << cScratchBuffers << " buffers of " << cMinHeapBlockSize << "-"
+              << cMaxHeapBlockSize << " bytes per round):\n";
+    std::cout << "    allocator   per buffer [ns]\n";
+
+    std::minstd_rand random;
+    std::uniform_int_distribution<std::size_t> sizes(cMinHeapBlockSize, cMaxHeapBlockSize);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; ++i) {
+        for (auto& buffer : buffers) {
+            buffer = pvPortMalloc(sizes(random));
+            if (buffer == nullptr)
+                return false;
+        }
+
+        for (auto* buffer : buffers)
+            vPortFree(buffer);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    auto heapLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; ++i) {
+        auto marker = arena.mark();
+        for (auto& buffer : buffers) {
+            buffer = arena.allocate(sizes(random));
+            if (buffer == nullptr)
+                return false;
+        }
+
+        arena.rewind(marker);
+    }
+
+    end = std::chrono::steady_clock::now();
+    auto arenaLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    std::cout << "    heap\t\t" << heapLatency / (cIterations * cScratchBuffers) << "\n";
+    std::cout << "    arena\t\t" << arenaLatency / (cIterations * cScratchBuffers) << "\n";
+    return true;
+}
+#endif
+
+} // namespace
+
+int appMain([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    if (!platform::init())
+        return EXIT_FAILURE;
+
+    vTaskPrioritySet(nullptr, cAppPriority);
+
+    if (!benchmarkSwitchLatency())
+        return EXIT_FAILURE;
+
+    if (!benchmarkBlockLatency())
+        return EXIT_FAILURE;
+
+    if (!benchmarkTimerResetLatency())
+        return EXIT_FAILURE;
+
+    if (!benchmarkQueueThroughput())
+        return EXIT_FAILURE;
+
+    if (!benchmarkSignalling())
+        return EXIT_FAILURE;
+
+    if (!benchmarkEventGroupLatency())
+        return EXIT_FAILURE;
+
+    if (!checkStreamBufferSpans())
+        return EXIT_FAILURE;
+
+    if (!checkQueueLoansAndBatches())
+        return EXIT_FAILURE;
+
+    if (!checkPools())
+        return EXIT_FAILURE;
+
+    if (!checkNotifyMutex())
+        return EXIT_FAILURE;
+
+    if (!checkMemoryFunctions())
+        return EXIT_FAILURE;
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+    if (!benchmarkHeapLatency())
+        return EXIT_FAILURE;
+
+    if (!benchmarkScratchAllocation())
+        return EXIT_FAILURE;
+#endif
+
+    std::cout << "PASSED\n";
+    return EXIT_SUCCESS;
+}
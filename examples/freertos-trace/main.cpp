@@ -0,0 +1,307 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/init.hpp"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <platform/clock.hpp>
+#include <platform/main.hpp>
+#include <platform/power.hpp>
+#if configUSE_CRITICAL_PROFILER
+    #include <platform/profiler.hpp>
+#endif
+#include <platform/stack.hpp>
+#include <platform/stats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+constexpr const char* cOutputFile = "freertos-trace.bin";
+constexpr const char* cProfilerOutputFile = "freertos-critical.bin";
+constexpr std::size_t cReportedSites = 5;
+constexpr int cRounds = 20;
+constexpr UBaseType_t cLowPriority = tskIDLE_PRIORITY + 2;
+constexpr UBaseType_t cMediumPriority = tskIDLE_PRIORITY + 3;
+constexpr UBaseType_t cHighPriority = tskIDLE_PRIORITY + 4;
+constexpr UBaseType_t cConsumerPriority = tskIDLE_PRIORITY + 5;
+constexpr std::size_t cStackSize = configMINIMAL_STACK_SIZE;
+constexpr UBaseType_t cQueueLength = 4;
+constexpr std::size_t cMaxTasks = 16;
+
+/// Objects shared by the traced tasks.
+struct Scenario {
+    SemaphoreHandle_t mutex;
+    QueueHandle_t samples;
+    TaskHandle_t owner;
+};
+
+/// Keeps the CPU busy for the given time, so tasks compete for it.
+/// @param duration         Time to be spent.
+void busyWait(std::chrono::microseconds duration)
+{
+    auto end = platform::clock::now() + duration;
+    while (platform::clock::now() < end) {
+    }
+}
+
+/// Holds the mutex for a long time. When the high priority task waits for the mutex, this task inherits its priority,
+/// so the medium priority task cannot preempt it (priority inversion is bounded).
+void lowThread(void* parameter)
+{
+    auto* scenario = static_cast<Scenario*>(parameter);
+    for (int i = 0; i < cRounds; ++i) {
+        xSemaphoreTake(scenario->mutex, portMAX_DELAY);
+        busyWait(std::chrono::milliseconds(2));
+        xSemaphoreGive(scenario->mutex);
+        vTaskDelay(2);
+    }
+
+    xTaskNotifyGive(scenario->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Periodically competes with the low priority task for the CPU.
+void mediumThread(void* parameter)
+{
+    auto* scenario = static_cast<Scenario*>(parameter);
+    for (int i = 0; i < cRounds; ++i) {
+        vTaskDelay(1);
+        busyWait(std::chrono::microseconds(500));
+        xQueueSend(scenario->samples, &i, 0);
+    }
+
+    xTaskNotifyGive(scenario->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Periodically waits for the mutex held by the low priority task.
+void highThread(void* parameter)
+{
+    auto* scenario = static_cast<Scenario*>(parameter);
+    for (int i = 0; i < cRounds; ++i) {
+        vTaskDelay(1);
+        xSemaphoreTake(scenario->mutex, portMAX_DELAY);
+        busyWait(std::chrono::microseconds(100));
+        xSemaphoreGive(scenario->mutex);
+        xQueueSend(scenario->samples, &i, 0);
+        vTaskDelay(2);
+    }
+
+    xTaskNotifyGive(scenario->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Slowly drains the queue filled by the other tasks, so they sometimes find it full.
+void consumerThread(void* parameter)
+{
+    auto* scenario = static_cast<Scenario*>(parameter);
+    int sample{};
+    while (xQueueReceive(scenario->samples, &sample, pdMS_TO_TICKS(20)) == pdPASS)
+        vTaskDelay(3);
+
+    xTaskNotifyGive(scenario->owner);
+    vTaskSuspend(nullptr);
+}
+
+/// Prints run time statistics of all tasks.
+void printStats()
+{
+    static platform::stats::Snapshot<cMaxTasks> snapshot;
+    if (!snapshot.update()) {
+        std::cout << "Failed to collect task statistics\n";
+        return;
+    }
+
+    std::printf("Task statistics:\n");
+    std::printf("    %-*s %10s %10s %18s\n", configMAX_TASK_NAME_LEN, "task", "cpu [%]", "switches", "max latency [ns]");
+    for (std::size_t i = 0; i < snapshot.size(); ++i) {
+        auto task = snapshot[i];
+        std::printf("    %-*s %10.1f %10lu %18llu\n",
+                    configMAX_TASK_NAME_LEN,
+                    task.name,
+                    static_cast<double>(task.cpuUsage),
+                    static_cast<unsigned long>(task.switches),
+                    static_cast<unsigned long long>(task.maxLatencyNs));
+    }
+}
+
+/// Prints statistics of the tickless idle.
+void printPowerStats()
+{
+    auto stats = platform::power::stats();
+    std::cout << "Tickless idle: " << stats.sleeps << " sleeps, " << stats.aborted << " aborted, "
+              << stats.suppressedTicks << " ticks suppressed\n";
+}
+
+/// Prints the longest critical sections and writes the profiler data to the file.
+/// @param path             Path of the output file.
+/// @return True on success, false otherwise.
+bool saveCriticalSections([[maybe_unused]] const char* path)
+{
+#if configUSE_CRITICAL_PROFILER
+    vCriticalProfilerStop();
+
+    static platform::profiler::Report report;
+    report.update();
+
+    std::cout << "Critical sections: " << report.sections() << " recorded, worst " << report.worstNs() << " ns at 0x"
+              << std::hex << report.worstSite() << std::dec << "\n";
+    std::cout << "    site          count       max [ns]    avg [ns]\n";
+    for (std::size_t i = 0; i < std::min(report.size(), cReportedSites); ++i) {
+        auto site = report[i];
+        std::cout << "    0x" << std::hex << site.address << std::dec << "\t" << site.count << "\t\t" << site.maxNs
+                  << "\t\t" << site.averageNs << "\n";
+    }
+
+    std::size_t size{};
+    const auto* data = pvCriticalProfilerGetData(&size);
+
+    auto* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool written = std::fwrite(data, 1, size, file) == size;
+    return std::fclose(file) == 0 && written;
+#else
+    std::cout << "Critical section profiler is disabled (configUSE_CRITICAL_PROFILER)\n";
+    return true;
+#endif
+}
+
+/// Writes the recorder data to the file.
+/// @param path             Path of the output file.
+/// @return True on success, false otherwise.
+bool saveTrace([[maybe_unused]] const char* path)
+{
+#if configUSE_TRACE_RECORDER
+    vTraceRecorderStop();
+
+    std::size_t size{};
+    const auto* data = pvTraceRecorderGetData(&size);
+
+    auto* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool written = std::fwrite(data, 1, size, file) == size;
+    return std::fclose(file) == 0 && written;
+#else
+    std::cout << "Trace recorder is disabled (configUSE_TRACE_RECORDER)\n";
+    return false;
+#endif
+}
+
+} // namespace
+
+int appMain([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    if (!platform::init())
+        return EXIT_FAILURE;
+
+    static Scenario scenario{};
+    static StaticSemaphore_t mutexBuffer{};
+    static StaticQueue_t samplesBuffer{};
+    static std::array<std::uint8_t, cQueueLength * sizeof(int)> samplesStorage{};
+    scenario.mutex = xSemaphoreCreateMutexStatic(&mutexBuffer);
+    scenario.samples = xQueueCreateStatic(cQueueLength, sizeof(int), samplesStorage.data(), &samplesBuffer);
+    scenario.owner = xTaskGetCurrentTaskHandle();
+    vQueueAddToRegistry(scenario.mutex, "mutex");
+    vQueueAddToRegistry(scenario.samples, "samples");
+
+    struct Thread {
+        TaskFunction_t function;
+        const char* name;
+        UBaseType_t priority;
+        StaticTask_t buffer;
+        std::array<StackType_t, cStackSize> stack;
+    };
+
+    static std::array<Thread, 4> threads = {{
+        {lowThread, "low", cLowPriority, {}, {}},
+        {mediumThread, "medium", cMediumPriority, {}, {}},
+        {highThread, "high", cHighPriority, {}, {}},
+        {consumerThread, "consumer", cConsumerPriority, {}, {}},
+    }};
+
+    std::array<TaskHandle_t, threads.size()> handles{};
+    for (std::size_t i = 0; i < threads.size(); ++i) {
+        auto& thread = threads.at(i);
+        handles.at(i) = xTaskCreateStatic(thread.function,
+                                          thread.name,
+                                          thread.stack.size(),
+                                          &scenario,
+                                          thread.priority,
+                                          thread.stack.data(),
+                                          &thread.buffer);
+        if (handles.at(i) == nullptr)
+            return EXIT_FAILURE;
+    }
+
+    for (std::size_t i = 0; i < threads.size(); ++i)
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+
+    printStats();
+    printPowerStats();
+
+#if configUSE_STACK_MONITOR
+    // Stack usage of the tasks is kept in the report printed at exit.
+    platform::stack::sample();
+#endif
+
+    for (auto* handle : handles)
+        vTaskDelete(handle);
+
+    if (!saveTrace(cOutputFile)) {
+        std::cout << "Failed to write " << cOutputFile << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Trace written to " << cOutputFile << ", convert it with tools/trace-converter.py\n";
+
+    if (!saveCriticalSections(cProfilerOutputFile)) {
+        std::cout << "Failed to write " << cProfilerOutputFile << "\n";
+        return EXIT_FAILURE;
+    }
+
+#if configUSE_CRITICAL_PROFILER
+    std::cout << "Critical sections written to " << cProfilerOutputFile << ", decode them with "
+              << "tools/critical-profiler.py\n";
+#endif
+    std::cout << "PASSED\n";
+    return EXIT_SUCCESS;
+}
@@ -28,14 +28,23 @@
 
 #include "platform/init.hpp"
 
+#include <platform/console.hpp>
 #include <stm32f4xx.h>
 
 #include <cstddef>
 #include <cstdint>
-#include <type_traits>
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 UART_HandleTypeDef uart{};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DMA_HandleTypeDef uartDma{};
+
+static bool consoleTransmit(const std::uint8_t* data, std::size_t size);
+
+// Output is buffered and sent by DMA, so printing doesn't wait for the UART. Writer waits only if the buffer is full.
+constexpr std::size_t cConsoleBufferSize = 2048;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+platform::StaticConsole<cConsoleBufferSize> console(consoleTransmit, platform::OverflowPolicy::Block);
 
 extern "C" {
 
@@ -51,7 +60,7 @@ void HAL_MspInit()
     __HAL_RCC_PWR_CLK_ENABLE();    // NOLINT
 }
 
-void HAL_UART_MspInit(UART_HandleTypeDef* /*unused*/)
+void HAL_UART_MspInit(UART_HandleTypeDef* handle)
 {
     __HAL_RCC_GPIOC_CLK_ENABLE(); // NOLINT
 
@@ -62,15 +71,58 @@ void HAL_UART_MspInit(UART_HandleTypeDef* /*unused*/)
     config.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
     config.Alternate = GPIO_AF8_UART4;
     HAL_GPIO_Init(GPIOC, &config); // NOLINT
+
+    // UART4_TX is served by DMA1 stream 4, channel 4.
+    __HAL_RCC_DMA1_CLK_ENABLE(); // NOLINT
+
+    uartDma.Instance = DMA1_Stream4; // NOLINT
+    uartDma.Init.Channel = DMA_CHANNEL_4;
+    uartDma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    uartDma.Init.PeriphInc = DMA_PINC_DISABLE;
+    uartDma.Init.MemInc = DMA_MINC_ENABLE;
+    uartDma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    uartDma.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    uartDma.Init.Mode = DMA_NORMAL;
+    uartDma.Init.Priority = DMA_PRIORITY_LOW;
+    uartDma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&uartDma);
+    __HAL_LINKDMA(handle, hdmatx, uartDma); // NOLINT
+
+    // Interrupts don't call any RTOS API, so they can preempt critical sections and writers waiting for the space.
+    constexpr std::uint32_t cConsoleIrqPriority = 0;
+    HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, cConsoleIrqPriority, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+    HAL_NVIC_SetPriority(UART4_IRQn, cConsoleIrqPriority, 0);
+    HAL_NVIC_EnableIRQ(UART4_IRQn);
+}
+
+// NOLINTNEXTLINE
+void DMA1_Stream4_IRQHandler()
+{
+    HAL_DMA_IRQHandler(&uartDma);
+}
+
+// NOLINTNEXTLINE
+void UART4_IRQHandler()
+{
+    HAL_UART_IRQHandler(&uart);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef* /*unused*/)
+{
+    console.transmitDone();
 }
 
 } // extern "C"
 
+static bool consoleTransmit(const std::uint8_t* data, std::size_t size)
+{
+    return HAL_UART_Transmit_DMA(&uart, data, static_cast<std::uint16_t>(size)) == HAL_OK;
+}
+
 int consolePrint(const char* message, std::size_t size)
 {
-    constexpr std::uint32_t cTimeout = 1000;
-    auto result = HAL_UART_Transmit(&uart, std::remove_const_t<std::uint8_t*>(message), size, cTimeout);
-    return (result == HAL_OK) ? int(size) : 0;
+    return int(console.write(message, size));
 }
 
 static bool consoleInitUart()
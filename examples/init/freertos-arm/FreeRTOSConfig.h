@@ -33,7 +33,13 @@ extern uint32_t SystemCoreClock;
 
 #define configUSE_PREEMPTION                    1
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
-#define configUSE_TICKLESS_IDLE                 0
+#define configUSE_PRIORITY_BITMAP_TASK_SELECTION 1
+#define configUSE_DELAYED_LIST_TIMING_WHEEL     1
+/* Tickless idle is implemented by the platform (value 2), but it has not run on a target yet, so it is disabled by
+   default and can be enabled from the command line (-DconfigUSE_TICKLESS_IDLE=2). */
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE             0
+#endif
 #define configCPU_CLOCK_HZ                      (SystemCoreClock)
 #define configTICK_RATE_HZ                      1000
 #define configMAX_PRIORITIES                    5
@@ -48,31 +54,71 @@ extern uint32_t SystemCoreClock;
 #define configUSE_ALTERNATIVE_API               0 /* Deprecated! */
 #define configQUEUE_REGISTRY_SIZE               10
 #define configUSE_QUEUE_SETS                    0
+#define configUSE_QUEUE_LOANS                   1
+#define configUSE_STREAM_BUFFER_LOCK_FREE       1
+#define configUSE_BLOCK_POOLS                   1
+#define configUSE_EVENT_GROUP_WAITER_INDEX      1
+#define configEVENT_GROUP_INDEXED_BITS          8 /* Each indexed bit adds a list (20 bytes) to every event group. */
+#define configUSE_SIZE_SPECIALISED_COPY         1
+#define configUSE_TASK_FPU_CONTROL              0 /* Not yet verified on a Cortex-M4F. */
 #define configUSE_TIME_SLICING                  1
 #define configUSE_NEWLIB_REENTRANT              1
 #define configENABLE_BACKWARD_COMPATIBILITY     0
-#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 1
 #define configSTACK_DEPTH_TYPE                  uint16_t
+#define configRECORD_STACK_HIGH_ADDRESS         1
 #define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
 
 /* Memory allocation related definitions. */
 #define configSUPPORT_STATIC_ALLOCATION         1
-#define configSUPPORT_DYNAMIC_ALLOCATION        0
-#define configTOTAL_HEAP_SIZE                   2048
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   2048 /* Unused, heap regions are defined by the linker script. */
 #define configAPPLICATION_ALLOCATED_HEAP        0
 
 /* Hook function related definitions. */
-#define configUSE_IDLE_HOOK                     0
+#define configUSE_IDLE_HOOK                     configUSE_STACK_MONITOR
 #define configUSE_TICK_HOOK                     0
 #define configCHECK_FOR_STACK_OVERFLOW          0
 #define configUSE_MALLOC_FAILED_HOOK            0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1
+#define configRUN_TIME_COUNTER_TYPE             uint64_t
 #define configUSE_TRACE_FACILITY                0
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Run time counter is provided by the platform from the monotonic clock (see lib/main/freertos-arm/stats.cpp). */
+uint64_t ullPlatformGetRunTimeCounter(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        ullPlatformGetRunTimeCounter()
+
+/* Trace recorder related definitions. Recorder hooks into every traced kernel operation, so it is disabled by default
+   and can be enabled from the command line for instrumented builds (-DconfigUSE_TRACE_RECORDER=1). */
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER            0
+#endif
+#define configTRACE_RECORDER_BUFFER_LENGTH      512
+#define configTRACE_RECORDER_MAX_OBJECTS        16
+
+/* Critical section profiler related definitions. Profiler times every kernel critical section, so it is an optional
+   instrumentation mode, disabled by default and enabled from the command line (-DconfigUSE_CRITICAL_PROFILER=1). */
+#ifndef configUSE_CRITICAL_PROFILER
+    #define configUSE_CRITICAL_PROFILER         0
+#endif
+#define configCRITICAL_PROFILER_MAX_SITES       64
+#define configCRITICAL_PROFILER_BUCKETS         16
+#define configCRITICAL_PROFILER_BUCKET_SHIFT    4
+
+/* Stack monitor related definitions. Monitor takes over vApplicationIdleHook(), so it is disabled by default and can be
+   enabled from the command line (-DconfigUSE_STACK_MONITOR=1). */
+#ifndef configUSE_STACK_MONITOR
+    #define configUSE_STACK_MONITOR             0
+#endif
+#define configSTACK_MONITOR_MAX_TASKS           16
+#define configSTACK_MONITOR_PERIOD_MS           100
+#define configSTACK_MONITOR_MARGIN_PERCENT      25
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
 #define configMAX_CO_ROUTINE_PRIORITIES         1
@@ -107,6 +153,7 @@ extern uint32_t SystemCoreClock;
 #define INCLUDE_xTaskGetSchedulerState                         1
 #define INCLUDE_xTaskGetCurrentTaskHandle                      1
 #define INCLUDE_uxTaskGetStackHighWaterMark                    0
+#define INCLUDE_uxTaskGetStackStats                            1
 #define INCLUDE_xTaskGetIdleTaskHandle                         0
 #define INCLUDE_eTaskGetState                                  0
 #define INCLUDE_xEventGroupSetBitFromISR                       1
@@ -129,5 +176,8 @@ extern uint32_t SystemCoreClock;
         }
 #endif
 
-/* Platform specific definitions. */
-#define APPMAIN_STACK_SIZE 1024
+/* Platform specific definitions. Stack size of appMain() can be overridden from the command line, e.g. with the value
+   recommended by the stack monitor. */
+#ifndef APPMAIN_STACK_SIZE
+    #define APPMAIN_STACK_SIZE 1024
+#endif
@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_DELAYED_LIST_TIMING_WHEEL     1
+#define configUSE_TICKLESS_IDLE                 2 /* Implemented by the platform. */
+#define configCPU_CLOCK_HZ                      1000000000
+#define configTICK_RATE_HZ                      1000
+#define configMINIMAL_STACK_SIZE                512
+#define configMAX_TASK_NAME_LEN                 16
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configUSE_ALTERNATIVE_API               0 /* Deprecated! */
+#define configQUEUE_REGISTRY_SIZE               10
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_QUEUE_LOANS                   1
+#define configUSE_STREAM_BUFFER_LOCK_FREE       1
+#define configUSE_BLOCK_POOLS                   1
+#define configUSE_EVENT_GROUP_WAITER_INDEX      1
+#define configUSE_SIZE_SPECIALISED_COPY         1
+#define configUSE_TIME_SLICING                  1
+#define configUSE_NEWLIB_REENTRANT              0 /* Host uses glibc. */
+#define configENABLE_BACKWARD_COMPATIBILITY     0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 1
+#define configSTACK_DEPTH_TYPE                  uint16_t
+#define configRECORD_STACK_HIGH_ADDRESS         1
+#define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
+
+/* Task selection and number of priorities can be overridden from the command line (see tools/benchmark-freertos.sh). */
+#ifndef configUSE_PRIORITY_BITMAP_TASK_SELECTION
+    #define configUSE_PRIORITY_BITMAP_TASK_SELECTION 1
+#endif
+#ifndef configMAX_PRIORITIES
+    #define configMAX_PRIORITIES                64
+#endif
+
+/* Memory allocation related definitions. */
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   (512 * 1024)
+#define configAPPLICATION_ALLOCATED_HEAP        0
+
+/* Hook function related definitions. */
+#define configUSE_IDLE_HOOK                     configUSE_STACK_MONITOR
+#define configUSE_TICK_HOOK                     0
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+
+/* Run time and task stats gathering related definitions. */
+#define configGENERATE_RUN_TIME_STATS           1
+#define configRUN_TIME_COUNTER_TYPE             uint64_t
+#define configUSE_TRACE_FACILITY                0
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+
+/* Run time counter is provided by the platform from the monotonic clock (see lib/main/freertos-arm/stats.cpp). */
+uint64_t ullPlatformGetRunTimeCounter(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        ullPlatformGetRunTimeCounter()
+
+/* Trace recorder related definitions. */
+#define configTRACE_RECORDER_BUFFER_LENGTH      4096
+#define configTRACE_RECORDER_MAX_OBJECTS        32
+
+/* Trace recorder can be disabled from the command line (see tools/benchmark-freertos.sh). */
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER            1
+#endif
+
+/* Critical section profiler related definitions. Profiler can be disabled from the command line (see
+   tools/benchmark-freertos.sh). Timestamps of the simulator are in nanoseconds. */
+#ifndef configUSE_CRITICAL_PROFILER
+    #define configUSE_CRITICAL_PROFILER         1
+#endif
+#define configCRITICAL_PROFILER_MAX_SITES       128
+#define configCRITICAL_PROFILER_BUCKETS         16
+#define configCRITICAL_PROFILER_BUCKET_SHIFT    6
+
+/* Stack monitor related definitions. Tasks of the simulator run on the host thread stacks, so stack usage is not
+   measured by default. */
+#ifndef configUSE_STACK_MONITOR
+    #define configUSE_STACK_MONITOR             0
+#endif
+#define configSTACK_MONITOR_MAX_TASKS           16
+#define configSTACK_MONITOR_PERIOD_MS           100
+#define configSTACK_MONITOR_MARGIN_PERCENT      25
+
+/* Co-routine related definitions. */
+#define configUSE_CO_ROUTINES                   0
+#define configMAX_CO_ROUTINE_PRIORITIES         1
+
+/* Software timer related definitions. */
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               3
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+#define configTIMER_HEAP_LENGTH                 2048
+
+/* Active timers list can be overridden from the command line (see tools/benchmark-freertos.sh). */
+#ifndef configUSE_TIMER_LIST_TIMING_WHEEL
+    #define configUSE_TIMER_LIST_TIMING_WHEEL   1
+#endif
+#ifndef configUSE_TIMER_LIST_HEAP
+    #define configUSE_TIMER_LIST_HEAP           0
+#endif
+
+/* Define to trap errors during development. */
+#define configASSERT(x)                                                                                                \
+    if ((x) == 0)                                                                                                      \
+    vAssertCalled(__FILE__, __LINE__)
+
+/* Optional functions - most linkers will remove unused functions anyway. */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xResumeFromISR                  1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     0
+#define INCLUDE_uxTaskGetStackStats             1
+#define INCLUDE_xTaskGetIdleTaskHandle          0
+#define INCLUDE_eTaskGetState                   0
+#define INCLUDE_xEventGroupSetBitFromISR        1
+#define INCLUDE_xTimerPendFunctionCall          0
+#define INCLUDE_xTaskAbortDelay                 0
+#define INCLUDE_xTaskGetHandle                  0
+#define INCLUDE_xTaskResumeFromISR              1
+
+#ifndef vAssertCalled
+    #define vAssertCalled(file, line) abort()
+#endif
+
+/* Platform specific definitions. Stack size of appMain() can be overridden from the command line, e.g. with the value
+   recommended by the stack monitor. */
+#ifndef APPMAIN_STACK_SIZE
+    #define APPMAIN_STACK_SIZE 1024
+#endif
@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/init.hpp"
+
+#include <platform/log.hpp>
+#include <platform/main.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+// Output of this example contains binary log frames. Decode it on the host with:
+//   platform-log-example | tools/log-decoder.py platform-log-example
+int appMain(int argc, char** argv)
+{
+    if (!platform::init())
+        return EXIT_FAILURE;
+
+    std::cout << "Regular text output is passed through the decoder unchanged.\n";
+
+    PLATFORM_LOG("Hello from binary log!");
+    PLATFORM_LOG("argc = %d, argv[0] = '%s'", argc, argv[0]);
+
+    constexpr std::int64_t cBig = -1234567890123;
+    constexpr std::uint64_t cHuge = UINT64_MAX;
+    PLATFORM_LOG("int64 = %lld, uint64 = %llu, hex = 0x%08x",
+                 static_cast<long long>(cBig),
+                 static_cast<unsigned long long>(cHuge),
+                 0xcafeU);
+
+    constexpr float cPi = 3.14159F;
+    constexpr double cE = 2.718281828;
+    PLATFORM_LOG("float = %.3f, double = %g, percent = 100%%", cPi, cE);
+
+    const char* name = "platform";
+    PLATFORM_LOG("char = '%c', string = %s, width = [%5d]", 'x', name, 42);
+
+    for (int i = 0; i < 3; ++i)
+        PLATFORM_LOG("loop iteration %d of %d", i + 1, 3);
+
+    std::cout << "PASSED\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/console.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace platform {
+
+Console::Console(std::span<std::uint8_t> buffer,
+                 std::span<std::uint8_t> chunk,
+                 TransmitFunction transmit,
+                 OverflowPolicy policy,
+                 WaitFunction wait)
+    : m_buffer(buffer)
+    , m_chunk(chunk)
+    , m_transmit(transmit)
+    , m_policy(policy)
+    , m_wait(wait)
+{}
+
+std::size_t Console::write(std::span<const std::uint8_t> data)
+{
+    std::size_t accepted = 0;
+    while (!data.empty()) {
+        auto part = data.first(std::min(data.size(), m_buffer.size()));
+        if (writePart(part))
+            accepted += part.size();
+        else
+            m_dropped.fetch_add(part.size(), std::memory_order_relaxed);
+
+        data = data.subspan(part.size());
+    }
+
+    kick();
+    return accepted;
+}
+
+std::size_t Console::write(const char* data, std::size_t size)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return write({reinterpret_cast<const std::uint8_t*>(data), size});
+}
+
+void Console::transmitDone()
+{
+    m_transmitted.fetch_add(m_inFlight, std::memory_order_relaxed);
+    drain();
+}
+
+void Console::flush()
+{
+    kick();
+    while (pending() != 0 || m_busy.load(std::memory_order_acquire))
+        wait();
+}
+
+std::size_t Console::pending() const
+{
+    auto head = m_reservation.load(std::memory_order_acquire) & cPositionMask;
+    return distance(m_tail.load(std::memory_order_acquire), head);
+}
+
+ConsoleStats Console::stats() const
+{
+    return {.written = m_written.load(std::memory_order_relaxed),
+            .transmitted = m_transmitted.load(std::memory_order_relaxed),
+            .dropped = m_dropped.load(std::memory_order_relaxed),
+            .overwritten = m_overwritten.load(std::memory_order_relaxed),
+            .peakUsage = m_peakUsage.load(std::memory_order_relaxed)};
+}
+
+bool Console::reserve(std::uint32_t size, std::uint32_t& head)
+{
+    auto reservation = m_reservation.load(std::memory_order_acquire);
+    while (true) {
+        head = reservation & cPositionMask;
+        auto used = distance(m_tail.load(std::memory_order_acquire), head);
+        if (used + size > m_buffer.size()) {
+            // Tail could have been read after the head was moved by other writer, so check again with fresh head.
+            auto current = m_reservation.load(std::memory_order_acquire);
+            if (current == reservation)
+                return false;
+
+            reservation = current;
+            continue;
+        }
+
+        auto newReservation = (reservation + cWriterOne) & ~cPositionMask;
+        newReservation |= (head + size) & cPositionMask;
+        if (m_reservation.compare_exchange_weak(reservation, newReservation, std::memory_order_acq_rel)) {
+            auto usage = std::size_t{used + size};
+            auto peak = m_peakUsage.load(std::memory_order_relaxed);
+            while (peak < usage && !m_peakUsage.compare_exchange_weak(peak, usage, std::memory_order_relaxed)) {}
+            return true;
+        }
+    }
+}
+
+void Console::commit()
+{
+    auto reservation = m_reservation.fetch_sub(cWriterOne, std::memory_order_acq_rel) - cWriterOne;
+    if ((reservation >> cWriterShift) != 0)
+        return;
+
+    // This was the last write in progress, so everything up to the head is written and can be published. Other writer
+    // could have published later head in the meantime, so commit position is only moved forward.
+    auto head = reservation & cPositionMask;
+    auto commit = m_commit.load(std::memory_order_relaxed);
+    while (true) {
+        auto ahead = distance(commit, head);
+        if (ahead == 0 || ahead > m_buffer.size())
+            return;
+
+        if (m_commit.compare_exchange_weak(commit, head, std::memory_order_release, std::memory_order_relaxed))
+            return;
+    }
+}
+
+bool Console::discard(std::uint32_t size)
+{
+    auto tail = m_tail.load(std::memory_order_acquire);
+    while (true) {
+        if (distance(tail, m_commit.load(std::memory_order_acquire)) < size)
+            return false;
+
+        if (m_tail.compare_exchange_weak(tail, (tail + size) & cPositionMask, std::memory_order_acq_rel)) {
+            m_overwritten.fetch_add(size, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+bool Console::writePart(std::span<const std::uint8_t> data)
+{
+    auto size = static_cast<std::uint32_t>(data.size());
+    std::uint32_t head{};
+    while (!reserve(size, head)) {
+        switch (m_policy) {
+            case OverflowPolicy::Drop: return false;
+            case OverflowPolicy::Block:
+                kick();
+                wait();
+                break;
+            case OverflowPolicy::Overwrite: {
+                auto free = m_buffer.size() - distance(m_tail.load(std::memory_order_acquire), head);
+                if (!discard(size - std::min<std::uint32_t>(size, free)))
+                    return false;
+                break;
+            }
+        }
+    }
+
+    // Data can wrap around the end of the ring buffer.
+    auto offset = head & (m_buffer.size() - 1);
+    auto first = std::min<std::size_t>(size, m_buffer.size() - offset);
+    std::memcpy(&m_buffer[offset], data.data(), first);
+    std::memcpy(m_buffer.data(), &data[first], size - first);
+
+    commit();
+    m_written.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+void Console::kick()
+{
+    if (!m_busy.exchange(true, std::memory_order_acq_rel))
+        drain();
+}
+
+void Console::drain()
+{
+    while (true) {
+        auto tail = m_tail.load(std::memory_order_acquire);
+        auto size = std::min<std::size_t>(distance(tail, m_commit.load(std::memory_order_acquire)), m_chunk.size());
+        if (size == 0) {
+            m_busy.store(false, std::memory_order_release);
+
+            // Writer could have committed data after the check above, but before transmission was marked as idle.
+            if (distance(m_tail.load(std::memory_order_acquire), m_commit.load(std::memory_order_acquire)) == 0
+                || m_busy.exchange(true, std::memory_order_acq_rel))
+                return;
+
+            continue;
+        }
+
+        auto offset = tail & (m_buffer.size() - 1);
+        auto first = std::min(size, m_buffer.size() - offset);
+        std::memcpy(m_chunk.data(), &m_buffer[offset], first);
+        std::memcpy(&m_chunk[first], m_buffer.data(), size - first);
+
+        // Free the space only if the data wasn't discarded (and possibly overwritten) by a writer in the meantime.
+        if (!m_tail.compare_exchange_strong(tail,
+                                            (tail + static_cast<std::uint32_t>(size)) & cPositionMask,
+                                            std::memory_order_acq_rel))
+            continue;
+
+        m_inFlight = static_cast<std::uint32_t>(size);
+        if (m_transmit(m_chunk.data(), size))
+            return;
+
+        m_dropped.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+void Console::wait() const
+{
+    if (m_wait != nullptr)
+        m_wait();
+}
+
+} // namespace platform
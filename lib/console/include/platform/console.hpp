@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace platform {
+
+/// Behavior of the console when there is no space left in its buffer.
+enum class OverflowPolicy {
+    Drop,     ///< New data is dropped.
+    Block,    ///< Writer waits until the data is transmitted. Must not be used in interrupts.
+    Overwrite ///< Oldest data which is not transmitted yet is discarded to make space for the new one.
+};
+
+/// Statistics of the console.
+struct ConsoleStats {
+    std::size_t written;     ///< Number of bytes written to the buffer.
+    std::size_t transmitted; ///< Number of bytes transmitted by the driver.
+    std::size_t dropped;     ///< Number of bytes dropped because of no space in the buffer or transmit error.
+    std::size_t overwritten; ///< Number of bytes discarded to make space for the new data.
+    std::size_t peakUsage;   ///< Maximal number of bytes held in the buffer at once.
+};
+
+/// Asynchronous console, which decouples writers from the (slow) output device.
+/// @note Writers only copy data to the ring buffer and return, so printing doesn't wait for e.g. the UART. Data is
+/// moved out of the ring in chunks and passed to the transmit function, which should start a DMA or interrupt driven
+/// transfer and return. Driver has to call transmitDone() when the chunk is sent (usually from the interrupt).
+/// @note Ring buffer is lock-free: any number of tasks and interrupts can write concurrently without disabling
+/// interrupts. Data written by one write() call is never interleaved with data of other writers.
+class Console {
+public:
+    /// Starts asynchronous transmission of the data.
+    /// @param data             Data to be transmitted. Stays valid until transmitDone() is called.
+    /// @param size             Number of bytes to be transmitted.
+    /// @return True if transmission was started, false otherwise (data is dropped).
+    using TransmitFunction = bool (*)(const std::uint8_t* data, std::size_t size);
+
+    /// Called repeatedly while writer or flush() waits for the data to be transmitted (e.g. to yield the CPU).
+    using WaitFunction = void (*)();
+
+    /// Maximal size of the ring buffer.
+    static constexpr std::size_t cMaxBufferSize = std::size_t{1} << 23U;
+
+    /// Constructor.
+    /// @param buffer           Memory of the ring buffer. Size has to be a power of two, up to cMaxBufferSize.
+    /// @param chunk            Memory holding the chunk being transmitted.
+    /// @param transmit         Function starting transmission of the chunk.
+    /// @param policy           Behavior when there is no space left in the ring buffer.
+    /// @param wait             Function called while waiting for the transmission. Busy waiting is used if nullptr.
+    Console(std::span<std::uint8_t> buffer,
+            std::span<std::uint8_t> chunk,
+            TransmitFunction transmit,
+            OverflowPolicy policy = OverflowPolicy::Drop,
+            WaitFunction wait = nullptr);
+
+    Console(const Console&) = delete;
+    Console(Console&&) = delete;
+    Console& operator=(const Console&) = delete;
+    Console& operator=(Console&&) = delete;
+    ~Console() = default;
+
+    /// Writes data to the console.
+    /// @param data             Data to be written.
+    /// @return Number of bytes accepted by the console.
+    /// @note Data bigger than the ring buffer is written in parts, each being subject to the overflow policy.
+    std::size_t write(std::span<const std::uint8_t> data);
+
+    /// Writes data to the console.
+    /// @param data             Data to be written.
+    /// @param size             Number of bytes to be written.
+    /// @return Number of bytes accepted by the console.
+    std::size_t write(const char* data, std::size_t size);
+
+    /// Notifies the console that the chunk passed to the transmit function is sent and starts sending the next one.
+    /// @note Should be called from the transmission complete interrupt.
+    void transmitDone();
+
+    /// Waits until all data written so far is transmitted.
+    /// @note Transmit complete interrupt has to be enabled, otherwise this function never returns.
+    void flush();
+
+    /// Returns number of bytes waiting for the transmission (including the ones being written now).
+    [[nodiscard]] std::size_t pending() const;
+
+    /// Returns statistics of the console.
+    [[nodiscard]] ConsoleStats stats() const;
+
+private:
+    /// Reserves space in the ring buffer.
+    /// @param size             Number of bytes to be reserved.
+    /// @param head             Output parameter for the position of the reserved space.
+    /// @return True if the space was reserved, false if there is not enough free space.
+    bool reserve(std::uint32_t size, std::uint32_t& head);
+
+    /// Marks reserved space as written and publishes it to the reader if no other write is in progress.
+    void commit();
+
+    /// Discards oldest data, which is not transmitted yet.
+    /// @param size             Number of bytes to be discarded.
+    /// @return True if the data was discarded, false if there is not enough data ready for the transmission.
+    bool discard(std::uint32_t size);
+
+    /// Writes one part of the data, not bigger than the ring buffer.
+    bool writePart(std::span<const std::uint8_t> data);
+
+    /// Starts the transmission if it is not in progress.
+    void kick();
+
+    /// Moves next chunk from the ring buffer and transmits it. Must be called with m_busy set.
+    void drain();
+
+    /// Calls the wait function or spins if it is not provided.
+    void wait() const;
+
+    /// Returns distance between two positions in the ring buffer.
+    static std::uint32_t distance(std::uint32_t from, std::uint32_t to) { return (to - from) & cPositionMask; }
+
+    // Positions in the ring buffer are free-running 24-bit counters. Reservation word holds the head (position of the
+    // next write) and the number of writes in progress, so both can be updated with one compare-and-swap.
+    static constexpr std::uint32_t cPositionMask = (1U << 24U) - 1;
+    static constexpr std::uint32_t cWriterShift = 24;
+    static constexpr std::uint32_t cWriterOne = 1U << cWriterShift;
+
+    std::span<std::uint8_t> m_buffer;
+    std::span<std::uint8_t> m_chunk;
+    TransmitFunction m_transmit;
+    OverflowPolicy m_policy;
+    WaitFunction m_wait;
+    std::atomic<std::uint32_t> m_reservation{};
+    std::atomic<std::uint32_t> m_commit{};
+    std::atomic<std::uint32_t> m_tail{};
+    std::atomic<bool> m_busy{};
+    std::uint32_t m_inFlight{};
+    std::atomic<std::size_t> m_written{};
+    std::atomic<std::size_t> m_transmitted{};
+    std::atomic<std::size_t> m_dropped{};
+    std::atomic<std::size_t> m_overwritten{};
+    std::atomic<std::size_t> m_peakUsage{};
+};
+
+/// Console with buffers sized at compile time.
+/// @tparam bufferSize      Size of the ring buffer in bytes. Has to be a power of two.
+/// @tparam chunkSize       Maximal number of bytes passed to the transmit function at once.
+template <std::size_t bufferSize, std::size_t chunkSize = 64>
+class StaticConsole : public Console {
+    static_assert(bufferSize > 0 && (bufferSize & (bufferSize - 1)) == 0 && bufferSize <= cMaxBufferSize);
+    static_assert(chunkSize > 0);
+
+public:
+    /// Constructor.
+    /// @param transmit         Function starting transmission of the chunk.
+    /// @param policy           Behavior when there is no space left in the ring buffer.
+    /// @param wait             Function called while waiting for the transmission. Busy waiting is used if nullptr.
+    explicit StaticConsole(TransmitFunction transmit,
+                           OverflowPolicy policy = OverflowPolicy::Drop,
+                           WaitFunction wait = nullptr)
+        : Console(m_storage, m_chunkStorage, transmit, policy, wait)
+    {}
+
+private:
+    std::array<std::uint8_t, bufferSize> m_storage{};
+    std::array<std::uint8_t, chunkSize> m_chunkStorage{};
+};
+
+} // namespace platform
@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/// Logs message with deferred formatting.
+/// @param format           printf-like format string literal. Trailing newline is added by the decoder.
+/// @note Format string is stored in a non-loaded ELF section (.platform_log), so it takes no flash and no time to
+/// process. Only 32-bit ID of the message and raw arguments are written to the console. Output has to be decoded on
+/// the host with tools/log-decoder.py using the ELF file of the application.
+#define PLATFORM_LOG(format, ...)                                                                                      \
+    do {                                                                                                               \
+        [[gnu::used, gnu::section(".platform_log")]] static constexpr char cPlatformLogRecord[] =                      \
+            __FILE__ "\x1f" PLATFORM_LOG_STRINGIFY(__LINE__) "\x1f" format;                                            \
+        static_cast<void>(sizeof(::platform::log::detail::checkFormat(format __VA_OPT__(, ) __VA_ARGS__)));           \
+        constexpr auto cPlatformLogId = ::platform::log::detail::hash(cPlatformLogRecord);                             \
+        ::platform::log::write(cPlatformLogId __VA_OPT__(, ) __VA_ARGS__);                                             \
+    } while (false)
+
+#define PLATFORM_LOG_STRINGIFY(value)      PLATFORM_LOG_STRINGIFY_IMPL(value)
+#define PLATFORM_LOG_STRINGIFY_IMPL(value) #value
+
+namespace platform::log {
+
+/// Byte starting every binary log frame. It is not used by text, so frames can be mixed with regular console output.
+constexpr std::uint8_t cFrameStart = 0x1e;
+
+/// Maximal size of the frame payload (message ID and arguments). Longer string arguments are truncated.
+constexpr std::size_t cMaxPayloadSize = 255;
+
+/// Tags describing the type of each encoded argument.
+namespace tag {
+constexpr std::uint8_t cInt32 = 'i';
+constexpr std::uint8_t cUint32 = 'u';
+constexpr std::uint8_t cInt64 = 'I';
+constexpr std::uint8_t cUint64 = 'U';
+constexpr std::uint8_t cFloat = 'f';
+constexpr std::uint8_t cDouble = 'd';
+constexpr std::uint8_t cString = 's';
+} // namespace tag
+
+/// Writes binary log frame to the output.
+/// @param data             Encoded frame.
+/// @param size             Size of the frame.
+/// @note Defined per platform: on Linux writes to stdout, on ARM passes the frame to consolePrint().
+void output(const std::uint8_t* data, std::size_t size);
+
+namespace detail {
+
+/// Computes 32-bit FNV-1a hash of the log record, which is used as the message ID.
+/// @param record           Log record (file, line and format string).
+consteval std::uint32_t hash(std::string_view record)
+{
+    constexpr std::uint32_t cOffsetBasis = 2166136261U;
+    constexpr std::uint32_t cPrime = 16777619U;
+
+    std::uint32_t value = cOffsetBasis;
+    for (char c : record) {
+        value ^= static_cast<std::uint8_t>(c);
+        value *= cPrime;
+    }
+
+    return value;
+}
+
+/// Never called, used only to let the compiler check the arguments against the format string.
+[[gnu::format(printf, 1, 2)]] int checkFormat(const char* format, ...);
+
+/// Builds binary log frame on the stack.
+class Encoder {
+public:
+    /// Constructor.
+    /// @param id               ID of the message.
+    explicit Encoder(std::uint32_t id)
+    {
+        m_buffer[0] = cFrameStart;
+        putRaw(id);
+    }
+
+    /// Appends integral or enumeration argument.
+    template <typename T>
+        requires std::integral<T> || std::is_enum_v<T>
+    void put(T value)
+    {
+        if constexpr (std::is_enum_v<T>) {
+            put(static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr (sizeof(T) <= sizeof(std::uint32_t)) {
+            if constexpr (std::is_signed_v<T>)
+                putTagged(tag::cInt32, static_cast<std::int32_t>(value));
+            else
+                putTagged(tag::cUint32, static_cast<std::uint32_t>(value));
+        }
+        else {
+            if constexpr (std::is_signed_v<T>)
+                putTagged(tag::cInt64, static_cast<std::int64_t>(value));
+            else
+                putTagged(tag::cUint64, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    /// Appends floating point argument.
+    void put(float value) { putTagged(tag::cFloat, value); }
+
+    /// Appends floating point argument.
+    void put(double value) { putTagged(tag::cDouble, value); }
+
+    /// Appends string argument.
+    void put(const char* value) { put(std::string_view(value != nullptr ? value : "(null)")); }
+
+    /// Appends string argument.
+    void put(std::string_view value)
+    {
+        if (m_size + 2 > cFrameSize)
+            return;
+
+        auto size = std::min(value.size(), cFrameSize - m_size - 2);
+        m_buffer[m_size++] = tag::cString;
+        m_buffer[m_size++] = static_cast<std::uint8_t>(size);
+        std::memcpy(&m_buffer[m_size], value.data(), size);
+        m_size += size;
+    }
+
+    /// Appends pointer argument.
+    void put(const void* value)
+    {
+        put(reinterpret_cast<std::uintptr_t>(value)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    /// Writes the frame to the output.
+    void flush()
+    {
+        m_buffer[1] = static_cast<std::uint8_t>(m_size - cHeaderSize);
+        output(m_buffer.data(), m_size);
+    }
+
+private:
+    template <typename T>
+    void putTagged(std::uint8_t tag, T value)
+    {
+        if (m_size + 1 + sizeof(T) > cFrameSize)
+            return;
+
+        m_buffer[m_size++] = tag;
+        putRaw(value);
+    }
+
+    template <typename T>
+    void putRaw(T value)
+    {
+        std::memcpy(&m_buffer[m_size], &value, sizeof(T));
+        m_size += sizeof(T);
+    }
+
+    static constexpr std::size_t cHeaderSize = 2;
+    static constexpr std::size_t cFrameSize = cHeaderSize + cMaxPayloadSize;
+
+    std::array<std::uint8_t, cFrameSize> m_buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::size_t m_size{cHeaderSize};
+};
+
+} // namespace detail
+
+/// Encodes the message and writes it to the output. Used by PLATFORM_LOG().
+/// @param id               ID of the message.
+/// @param args             Arguments of the message.
+template <typename... Args>
+void write(std::uint32_t id, const Args&... args)
+{
+    detail::Encoder encoder(id);
+    (encoder.put(args), ...);
+    encoder.flush();
+}
+
+} // namespace platform::log
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/clock.hpp"
+
+#include <cstdint>
+
+/// Core clock frequency in Hz, provided by CMSIS device support (system_<device>.c).
+extern "C" std::uint32_t SystemCoreClock; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace {
+
+// Registers of the Data Watchpoint and Trace unit (ARMv7-M architecture reference manual, C1.8).
+constexpr std::uintptr_t cDemcrAddress = 0xe000edfc;
+constexpr std::uint32_t cDemcrTrcena = 1U << 24U;
+constexpr std::uintptr_t cDwtCtrlAddress = 0xe0001000;
+constexpr std::uint32_t cDwtCtrlCyccntena = 1U << 0U;
+constexpr std::uintptr_t cDwtCyccntAddress = 0xe0001004;
+constexpr std::uintptr_t cDwtLarAddress = 0xe0001fb0;
+constexpr std::uint32_t cDwtLarUnlockKey = 0xc5acce55;
+
+/// Returns reference to the memory mapped register.
+/// @param address          Address of the register.
+volatile std::uint32_t& reg(std::uintptr_t address)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return *reinterpret_cast<volatile std::uint32_t*>(address);
+}
+
+/// Disables interrupts and returns previous state of PRIMASK.
+std::uint32_t disableInterrupts()
+{
+    std::uint32_t primask{};
+    asm volatile("mrs %0, primask\n"
+                 "cpsid i"
+                 : "=r"(primask)
+                 :
+                 : "memory");
+    return primask;
+}
+
+/// Restores state of PRIMASK saved by disableInterrupts().
+/// @param primask          Saved state of PRIMASK.
+void restoreInterrupts(std::uint32_t primask)
+{
+    asm volatile("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+} // namespace
+
+namespace platform::clock {
+
+// CYCCNT is only 32 bits wide (~25 s at 168 MHz). Upper half of the counter is extended in software by detecting
+// wraps between the calls, so the counter has to be read at least once per wrap period (see clock.hpp). Nothing here
+// owns a periodic interrupt, so applications which can be idle longer than that should call ticks() e.g. from SysTick.
+std::uint64_t ticks()
+{
+    static bool started{};
+    static std::uint32_t high{};
+    static std::uint32_t last{};
+
+    auto primask = disableInterrupts();
+    if (!started) {
+        reg(cDemcrAddress) = reg(cDemcrAddress) | cDemcrTrcena;
+        reg(cDwtLarAddress) = cDwtLarUnlockKey;
+        reg(cDwtCyccntAddress) = 0;
+        reg(cDwtCtrlAddress) = reg(cDwtCtrlAddress) | cDwtCtrlCyccntena;
+        started = true;
+    }
+
+    auto low = reg(cDwtCyccntAddress);
+    if (low < last)
+        ++high;
+
+    last = low;
+    restoreInterrupts(primask);
+
+    return (std::uint64_t{high} << 32U) | low;
+}
+
+std::uint64_t frequency()
+{
+    return SystemCoreClock;
+}
+
+} // namespace platform::clock
@@ -26,6 +26,7 @@
 ///
 /////////////////////////////////////////////////////////////////////////////////////
 
+#include <platform/clock.hpp>
 #include <platform/main.hpp>
 
 #include <array>
@@ -36,6 +37,9 @@
 /// that argv[0] contains the name of the binary.
 int main()
 {
+    // Start the monotonic clock, so its time is counted from the boot.
+    platform::clock::ticks();
+
     static auto argv0 = std::to_array("appMain");
     std::array<char*, 1> argv = {argv0.data()};
     return appMain(static_cast<int>(argv.size()), argv.data());
@@ -26,11 +26,13 @@
 ///
 /////////////////////////////////////////////////////////////////////////////////////
 
+#include <platform/clock.hpp>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -113,8 +115,10 @@ size_t fwrite(const void* ptr, size_t /*unused*/, size_t _n, FILE* /*unused*/)
 int _gettimeofday(struct timeval* tp, void* /*unused*/)
 {
     if (tp != nullptr) {
-        tp->tv_usec = 0;
-        tp->tv_sec = 0;
+        constexpr std::int64_t cUsInSec = 1000000;
+        auto nowUs = std::chrono::duration_cast<std::chrono::microseconds>(platform::clock::now()).count();
+        tp->tv_sec = static_cast<time_t>(nowUs / cUsInSec);
+        tp->tv_usec = static_cast<suseconds_t>(nowUs % cUsInSec);
     }
 
     return 0;
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/clock.hpp"
+
+#include "systick.hpp"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <cstdint>
+
+namespace platform::clock {
+
+// RTOS tick count is extended to 64 bits by the kernel. On Cortex-M the time elapsed since the last tick is read from
+// the SysTick timer, which counts down from the reload value, so the resolution is one SysTick clock cycle.
+std::uint64_t ticks()
+{
+    auto state = taskENTER_CRITICAL_FROM_ISR();
+    auto tickCount = ullTaskGetTickCount64();
+
+#if PLATFORM_CLOCK_USE_SYSTICK
+    auto reload = systick::reg(systick::cSystRvrAddress);
+    auto current = systick::reg(systick::cSystCvrAddress);
+    auto elapsed = std::uint64_t{systick::sleepOffset};
+
+    // Timer could have wrapped before the tick interrupt was handled. Current value has to be read again, because it
+    // could have been read just before the wrap.
+    if ((systick::reg(systick::cIcsrAddress) & systick::cIcsrPendstset) != 0) {
+        current = systick::reg(systick::cSystCvrAddress);
+        elapsed += std::uint64_t{reload} + 1;
+    }
+
+    // Inside the tick interrupt (or an interrupt preempting it) the timer has already wrapped and the pending flag is
+    // cleared, but the tick count is not incremented yet. Time is then held at the last returned value, so it never
+    // goes backwards. During tickless idle the timer is reloaded to count several ticks, so the time since the last
+    // tick is measured from the sleep offset and not from the tick period.
+    static std::uint64_t last{};
+    elapsed += reload - current;
+    auto now = tickCount * (frequency() / configTICK_RATE_HZ) + elapsed;
+    if (now < last)
+        now = last;
+
+    last = now;
+    taskEXIT_CRITICAL_FROM_ISR(state);
+    return now;
+#else
+    taskEXIT_CRITICAL_FROM_ISR(state);
+    return tickCount;
+#endif
+}
+
+std::uint64_t frequency()
+{
+#if PLATFORM_CLOCK_USE_SYSTICK
+    #ifdef configSYSTICK_CLOCK_HZ
+    return configSYSTICK_CLOCK_HZ;
+    #else
+    return configCPU_CLOCK_HZ;
+    #endif
+#else
+    return configTICK_RATE_HZ;
+#endif
+}
+
+} // namespace platform::clock
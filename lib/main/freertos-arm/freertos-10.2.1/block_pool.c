@@ -0,0 +1,381 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "block_pool.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include block pool functionality. */
+#if( configUSE_BLOCK_POOLS == 1 )
+
+/* The counting semaphore embedded in the pool, which holds the number of blocks
+that can still be allocated and queues the tasks waiting for a block. */
+#define blockpoolSEMAPHORE( pxPool ) ( ( SemaphoreHandle_t ) &( ( pxPool )->xAvailableBlocks ) )
+
+/* Link stored in the first bytes of every free block. */
+typedef struct xFREE_BLOCK
+{
+	struct xFREE_BLOCK *pxNextFreeBlock;
+} FreeBlock_t;
+
+typedef struct BlockPoolDefinition
+{
+	StaticSemaphore_t xAvailableBlocks;	/*< Counts the blocks that can be allocated, and blocks the tasks waiting for a block. */
+	FreeBlock_t *pxFreeList;			/*< The head of the list of free blocks. */
+	uint8_t *pucStorageStart;			/*< The first block of the pool. */
+	uint8_t *pucStorageEnd;				/*< One byte past the last block of the pool. */
+	size_t xBlockSize;					/*< The size of every block, a multiple of portBYTE_ALIGNMENT. */
+	UBaseType_t uxBlockCount;			/*< The number of blocks in the pool. */
+	UBaseType_t uxBlocksFree;			/*< The number of blocks in the free list. */
+	UBaseType_t uxMinimumEverFree;		/*< The lowest value of uxBlocksFree since the pool was created. */
+	UBaseType_t uxAllocations;			/*< The number of successful allocations. */
+	UBaseType_t uxFailedAllocations;	/*< The number of allocations that failed because the pool was exhausted. */
+	uint8_t ucStaticallyAllocated;		/*< Set to pdTRUE if the pool was created with xBlockPoolCreateStatic(). */
+} BlockPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Builds the free list out of the storage area and creates the semaphore.
+ */
+static void prvInitialiseBlockPool( BlockPool_t * const pxPool,
+									size_t xBlockSize,
+									UBaseType_t uxBlockCount,
+									uint8_t * const pucPoolStorageArea,
+									uint8_t ucStaticallyAllocated ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes the first block from the free list.  Must be called with a count taken
+ * from the semaphore, which guarantees the list is not empty.
+ */
+static void *prvPopFreeBlock( BlockPool_t * const pxPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Puts the block at the head of the free list.
+ */
+static void prvPushFreeBlock( BlockPool_t * const pxPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize,
+										  UBaseType_t uxBlockCount,
+										  uint8_t *pucPoolStorageArea,
+										  StaticBlockPool_t *pxStaticBlockPool )
+{
+BlockPool_t * const pxPool = ( BlockPool_t * ) pxStaticBlockPool; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+	configASSERT( pucPoolStorageArea );
+	configASSERT( pxStaticBlockPool );
+	configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+
+	#if( configASSERT_DEFINED == 1 )
+	{
+		/* Sanity check that the size of the structure used to declare a
+		variable of type StaticBlockPool_t equals the size of the real block
+		pool structure. */
+		volatile size_t xSize = sizeof( StaticBlockPool_t );
+		configASSERT( xSize == sizeof( BlockPool_t ) );
+	} /*lint !e529 xSize is referenced if configASSERT() is defined. */
+	#endif /* configASSERT_DEFINED */
+
+	if( ( pucPoolStorageArea != NULL ) && ( pxStaticBlockPool != NULL ) )
+	{
+		prvInitialiseBlockPool( pxPool, xBlockSize, uxBlockCount, pucPoolStorageArea, pdTRUE );
+		return pxPool;
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount )
+	{
+	BlockPool_t *pxPool;
+	const size_t xHeaderSize = ( sizeof( BlockPool_t ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+
+		/* The storage area directly follows the pool structure. */
+		pxPool = ( BlockPool_t * ) pvPortMalloc( xHeaderSize + blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) ); /*lint !e9087 !e9079 pvPortMalloc() always ensures returned memory blocks are aligned per the requirements of the MCU stack. */
+
+		if( pxPool != NULL )
+		{
+			prvInitialiseBlockPool( pxPool, xBlockSize, uxBlockCount, ( ( uint8_t * ) pxPool ) + xHeaderSize, pdFALSE );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxPool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vBlockPoolDelete( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxPool = xBlockPool;
+
+	configASSERT( pxPool );
+	configASSERT( pxPool->uxBlocksFree == pxPool->uxBlockCount );
+
+	vSemaphoreDelete( blockpoolSEMAPHORE( pxPool ) );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( pxPool->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxPool );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void *pvBlockPoolAllocate( BlockPoolHandle_t xBlockPool, TickType_t xTicksToWait )
+{
+BlockPool_t * const pxPool = xBlockPool;
+void *pvBlock = NULL;
+
+	configASSERT( pxPool );
+
+	/* The semaphore blocks the task until a block is available and reserves it,
+	so taking it from the free list cannot fail. */
+	if( xSemaphoreTake( blockpoolSEMAPHORE( pxPool ), xTicksToWait ) == pdPASS )
+	{
+		taskENTER_CRITICAL();
+		{
+			pvBlock = prvPopFreeBlock( pxPool );
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		taskENTER_CRITICAL();
+		{
+			pxPool->uxFailedAllocations++;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void *pvBlockPoolAllocateFromISR( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxPool = xBlockPool;
+void *pvBlock = NULL;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxPool );
+
+	/* No task ever blocks giving a counting semaphore, so taking it cannot
+	unblock a task. */
+	if( xSemaphoreTakeFromISR( blockpoolSEMAPHORE( pxPool ), NULL ) == pdPASS )
+	{
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			pvBlock = prvPopFreeBlock( pxPool );
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			pxPool->uxFailedAllocations++;
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFree( BlockPoolHandle_t xBlockPool, void *pvBlock )
+{
+BlockPool_t * const pxPool = xBlockPool;
+
+	configASSERT( pxPool );
+
+	/* The block is put back on the free list before the semaphore is given, so
+	the task woken by the semaphore always finds it there. */
+	taskENTER_CRITICAL();
+	{
+		prvPushFreeBlock( pxPool, pvBlock );
+	}
+	taskEXIT_CRITICAL();
+
+	( void ) xSemaphoreGive( blockpoolSEMAPHORE( pxPool ) );
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFreeFromISR( BlockPoolHandle_t xBlockPool, void *pvBlock, BaseType_t *pxHigherPriorityTaskWoken )
+{
+BlockPool_t * const pxPool = xBlockPool;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxPool );
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		prvPushFreeBlock( pxPool, pvBlock );
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+	( void ) xSemaphoreGiveFromISR( blockpoolSEMAPHORE( pxPool ), pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBlockPoolBlocksAvailable( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxPool = xBlockPool;
+
+	configASSERT( pxPool );
+
+	return uxSemaphoreGetCount( blockpoolSEMAPHORE( pxPool ) );
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolGetStats( BlockPoolHandle_t xBlockPool, BlockPoolStats_t *pxStats )
+{
+BlockPool_t * const pxPool = xBlockPool;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxPool );
+	configASSERT( pxStats );
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		pxStats->xBlockSize = pxPool->xBlockSize;
+		pxStats->uxBlockCount = pxPool->uxBlockCount;
+		pxStats->uxBlocksAvailable = pxPool->uxBlocksFree;
+		pxStats->uxMinimumEverAvailable = pxPool->uxMinimumEverFree;
+		pxStats->uxAllocations = pxPool->uxAllocations;
+		pxStats->uxFailedAllocations = pxPool->uxFailedAllocations;
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseBlockPool( BlockPool_t * const pxPool,
+									size_t xBlockSize,
+									UBaseType_t uxBlockCount,
+									uint8_t * const pucPoolStorageArea,
+									uint8_t ucStaticallyAllocated )
+{
+FreeBlock_t *pxBlock;
+UBaseType_t uxBlock;
+
+	configASSERT( ( ( ( size_t ) pucPoolStorageArea ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+
+	pxPool->xBlockSize = blockpoolBLOCK_SIZE( xBlockSize );
+	pxPool->uxBlockCount = uxBlockCount;
+	pxPool->pucStorageStart = pucPoolStorageArea;
+	pxPool->pucStorageEnd = pucPoolStorageArea + ( pxPool->xBlockSize * ( size_t ) uxBlockCount );
+	pxPool->uxBlocksFree = uxBlockCount;
+	pxPool->uxMinimumEverFree = uxBlockCount;
+	pxPool->uxAllocations = 0;
+	pxPool->uxFailedAllocations = 0;
+	pxPool->ucStaticallyAllocated = ucStaticallyAllocated;
+
+	/* Link the blocks in address order, so they are handed out in order while
+	the pool is used for the first time. */
+	pxPool->pxFreeList = ( FreeBlock_t * ) pucPoolStorageArea; /*lint !e9087 !e9079 Storage area is aligned, as checked above. */
+	pxBlock = pxPool->pxFreeList;
+	for( uxBlock = 1; uxBlock < uxBlockCount; uxBlock++ )
+	{
+		pxBlock->pxNextFreeBlock = ( FreeBlock_t * ) ( ( ( uint8_t * ) pxBlock ) + pxPool->xBlockSize );
+		pxBlock = pxBlock->pxNextFreeBlock;
+	}
+	pxBlock->pxNextFreeBlock = NULL;
+
+	( void ) xSemaphoreCreateCountingStatic( uxBlockCount, uxBlockCount, &( pxPool->xAvailableBlocks ) );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvPopFreeBlock( BlockPool_t * const pxPool )
+{
+FreeBlock_t * const pxBlock = pxPool->pxFreeList;
+
+	configASSERT( pxBlock );
+
+	pxPool->pxFreeList = pxBlock->pxNextFreeBlock;
+	pxPool->uxBlocksFree--;
+	pxPool->uxAllocations++;
+
+	if( pxPool->uxBlocksFree < pxPool->uxMinimumEverFree )
+	{
+		pxPool->uxMinimumEverFree = pxPool->uxBlocksFree;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPushFreeBlock( BlockPool_t * const pxPool, void *pvBlock )
+{
+FreeBlock_t * const pxBlock = ( FreeBlock_t * ) pvBlock;
+
+	/* The block must belong to the pool, and no more blocks can be freed than
+	were allocated. */
+	configASSERT( ( ( uint8_t * ) pvBlock >= pxPool->pucStorageStart ) && ( ( uint8_t * ) pvBlock < pxPool->pucStorageEnd ) );
+	configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBlock - pxPool->pucStorageStart ) % pxPool->xBlockSize ) == 0 );
+	configASSERT( pxPool->uxBlocksFree < pxPool->uxBlockCount );
+
+	pxBlock->pxNextFreeBlock = pxPool->pxFreeList;
+	pxPool->pxFreeList = pxBlock;
+	pxPool->uxBlocksFree++;
+}
+
+#endif /* configUSE_BLOCK_POOLS */
@@ -0,0 +1,298 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include the critical section profiler. */
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+/* Returns the address the hook returns to, i.e. the call site in the code
+entering the section.  Only the lower 32 bits are kept, which is enough to
+tell apart the sites within the same program. */
+#define profilerCALL_SITE() ( ( uint32_t ) ( uintptr_t ) __builtin_return_address( 0 ) )
+
+/* The header is initialised statically, so sections are recorded from the
+very first one, before the scheduler is started. */
+CriticalProfiler_t xCriticalProfiler =
+{
+	{
+		profilerMAGIC,
+		profilerVERSION,
+		( uint16_t ) sizeof( CriticalProfilerHeader_t ),
+		( uint16_t ) sizeof( CriticalProfilerSite_t ),
+		( uint16_t ) configCRITICAL_PROFILER_BUCKETS,
+		configCRITICAL_PROFILER_MAX_SITES,
+		configCRITICAL_PROFILER_BUCKET_SHIFT,
+		1U,
+		0U,
+		0U,
+		0U,
+		0U,
+		0U,
+		0U,
+		0U
+	},
+	{ 0U },
+	{ { 0U, 0U, 0U, 0U, 0U } }
+};
+
+/* State of the section being measured.  It is only accessed with interrupts
+masked, so it needs no further protection. */
+static UBaseType_t uxSectionDepth = 0U;				/*< The nesting depth of the critical sections. */
+static BaseType_t xInterruptsDisabled = pdFALSE;	/*< Set if interrupts were disabled outside of a critical section. */
+static uint32_t ulSectionStart = 0U;				/*< The timestamp of the beginning of the section. */
+static uint32_t ulSectionSite = 0U;					/*< The call site that started the section. */
+
+/*
+ * Accounts the section which has just ended.
+ */
+static void prvRecordSection( void );
+
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerStart( void )
+{
+	/* A single word is written, so the profiler can also be started and
+	stopped from ISRs.  Sections are tracked also while the profiler is
+	stopped, only their recording is suspended. */
+	xCriticalProfiler.xHeader.ulEnabled = 1U;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerStop( void )
+{
+	xCriticalProfiler.xHeader.ulEnabled = 0U;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerReset( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = uxCriticalProfilerMaskInterrupts();
+	{
+		( void ) memset( xCriticalProfiler.ulHistogram, 0x00, sizeof( xCriticalProfiler.ulHistogram ) );
+		( void ) memset( xCriticalProfiler.xSites, 0x00, sizeof( xCriticalProfiler.xSites ) );
+		xCriticalProfiler.xHeader.ulSections = 0U;
+		xCriticalProfiler.xHeader.ulMissedSites = 0U;
+		xCriticalProfiler.xHeader.ulMaxDuration = 0U;
+		xCriticalProfiler.xHeader.ulMaxSite = 0U;
+	}
+	vCriticalProfilerUnmaskInterrupts( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+const void *pvCriticalProfilerGetData( size_t *pxSize )
+{
+	configASSERT( pxSize );
+
+	/* The frequency and the reference address are only needed by the host
+	tools, so they are not set until the data is read. */
+	xCriticalProfiler.xHeader.ullTimestampFrequency = ullCriticalProfilerGetTimestampFrequency();
+	xCriticalProfiler.xHeader.ulReference = ( uint32_t ) ( uintptr_t ) &vCriticalProfilerReset;
+
+	*pxSize = sizeof( xCriticalProfiler );
+	return &xCriticalProfiler;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerEnter( void )
+{
+	if( uxSectionDepth == 0U )
+	{
+		/* Interrupts could have been disabled by the port just before (e.g.
+		by vPortEnterCritical()), in which case the section is restarted, so
+		it is attributed to the code entering the critical section. */
+		ulSectionStart = ulCriticalProfilerGetTimestamp();
+		ulSectionSite = profilerCALL_SITE();
+		xInterruptsDisabled = pdFALSE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxSectionDepth++;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerExit( void )
+{
+	/* The depth is zero if the section was entered by another task, which
+	switched to this one before leaving it. */
+	if( uxSectionDepth > 0U )
+	{
+		uxSectionDepth--;
+
+		if( uxSectionDepth == 0U )
+		{
+			prvRecordSection();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerDisable( void )
+{
+	if( ( uxSectionDepth == 0U ) && ( xInterruptsDisabled == pdFALSE ) )
+	{
+		ulSectionStart = ulCriticalProfilerGetTimestamp();
+		ulSectionSite = profilerCALL_SITE();
+		xInterruptsDisabled = pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerEnable( void )
+{
+	/* Interrupts enabled by the port when leaving a critical section (e.g. by
+	vPortExitCritical()) were already accounted by vCriticalProfilerExit(). */
+	if( ( uxSectionDepth == 0U ) && ( xInterruptsDisabled != pdFALSE ) )
+	{
+		xInterruptsDisabled = pdFALSE;
+		prvRecordSection();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerTaskSwitch( void )
+{
+	/* A section does not continue in the task switched in, so it is accounted
+	up to the switch. */
+	if( ( uxSectionDepth > 0U ) || ( xInterruptsDisabled != pdFALSE ) )
+	{
+		uxSectionDepth = 0U;
+		xInterruptsDisabled = pdFALSE;
+		prvRecordSection();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordSection( void )
+{
+uint32_t ulDuration = ulCriticalProfilerGetTimestamp() - ulSectionStart;
+uint32_t ulScaled, ulIndex, ulProbe;
+UBaseType_t uxBucket = 0U;
+CriticalProfilerSite_t *pxSite = NULL;
+
+	if( xCriticalProfiler.xHeader.ulEnabled != 0U )
+	{
+		/* The histogram buckets grow by powers of two, so the bucket is found
+		by shifting instead of dividing. */
+		ulScaled = ulDuration >> configCRITICAL_PROFILER_BUCKET_SHIFT;
+		while( ( ulScaled != 0U ) && ( uxBucket < ( UBaseType_t ) ( configCRITICAL_PROFILER_BUCKETS - 1 ) ) )
+		{
+			ulScaled >>= 1;
+			uxBucket++;
+		}
+
+		( xCriticalProfiler.ulHistogram[ uxBucket ] )++;
+		( xCriticalProfiler.xHeader.ulSections )++;
+
+		if( ulDuration > xCriticalProfiler.xHeader.ulMaxDuration )
+		{
+			xCriticalProfiler.xHeader.ulMaxDuration = ulDuration;
+			xCriticalProfiler.xHeader.ulMaxSite = ulSectionSite;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Call sites are kept in an open addressing hash table, indexed by
+		the site address (instructions are at least two bytes long, so the
+		lowest bit is skipped). */
+		ulIndex = ulSectionSite >> 1;
+		for( ulProbe = 0U; ulProbe < ( uint32_t ) configCRITICAL_PROFILER_MAX_SITES; ulProbe++ )
+		{
+			pxSite = &( xCriticalProfiler.xSites[ ( ulIndex + ulProbe ) & ( ( uint32_t ) configCRITICAL_PROFILER_MAX_SITES - 1U ) ] );
+			if( ( pxSite->ulSite == ulSectionSite ) || ( pxSite->ulSite == 0U ) )
+			{
+				break;
+			}
+
+			pxSite = NULL;
+		}
+
+		if( pxSite != NULL )
+		{
+			pxSite->ulSite = ulSectionSite;
+			( pxSite->ulCount )++;
+			pxSite->ullTotalDuration += ulDuration;
+
+			if( ulDuration > pxSite->ulMaxDuration )
+			{
+				pxSite->ulMaxDuration = ulDuration;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			( xCriticalProfiler.xHeader.ulMissedSites )++;
+		}
+	}
+}
+
+#endif /* configUSE_CRITICAL_PROFILER */
@@ -60,11 +60,25 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
 #endif
 
+#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	#if( ( configEVENT_GROUP_INDEXED_BITS < 1 ) || ( ( configUSE_16_BIT_TICKS == 1 ) && ( configEVENT_GROUP_INDEXED_BITS > 8 ) ) || ( configEVENT_GROUP_INDEXED_BITS > 24 ) )
+		#error configEVENT_GROUP_INDEXED_BITS must be between 1 and the number of bits available in an event group.
+	#endif
+
+	/* The event bits that have their own list of waiting tasks. */
+	#define eventINDEXED_BITS	( ( EventBits_t ) ( ( ( EventBits_t ) 1 << configEVENT_GROUP_INDEXED_BITS ) - ( EventBits_t ) 1 ) )
+#endif
+
 typedef struct EventGroupDef_t
 {
 	EventBits_t uxEventBits;
 	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
 
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+		EventBits_t uxBitsWaitedFor;	/*< Bits waited for by the tasks in xTasksWaitingForBits.  It can also include bits of tasks that have timed out since, until the list is next scanned. */
+		List_t xTasksWaitingForBit[ configEVENT_GROUP_INDEXED_BITS ];	/*< Tasks waiting for a single indexed bit to be set, one list per bit. */
+	#endif
+
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
 	#endif
@@ -86,6 +100,33 @@ typedef struct EventGroupDef_t
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialises the lists of tasks waiting for bits of a new event group.
+ */
+static void prvInitialiseWaitLists( EventGroup_t *pxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the list on which a task waiting for uxBitsToWaitFor is placed.  When
+ * the waiter index is used, tasks waiting for a single indexed bit are placed
+ * on the list of that bit, so setting other bits never has to look at them.
+ * Tasks waiting for several bits are placed on xTasksWaitingForBits, and their
+ * bits are added to the summary of bits waited for on that list.
+ */
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the tasks from pxList whose wait condition is met by the current
+ * event bits.  The bits to be cleared on exit by the unblocked tasks are added
+ * to *puxBitsToClear.  Returns the bits waited for by the tasks remaining on the
+ * list.  Must be called with the scheduler suspended.
+ */
+static EventBits_t prvUnblockMatchingTasks( EventGroup_t *pxEventBits, List_t const *pxList, EventBits_t *puxBitsToClear ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks all the tasks from pxList, as when the event group is deleted.
+ */
+static void prvUnblockAllTasks( List_t const *pxList ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -113,7 +154,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 		if( pxEventBits != NULL )
 		{
 			pxEventBits->uxEventBits = 0;
-			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+			prvInitialiseWaitLists( pxEventBits );
 
 			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
@@ -164,7 +205,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 		if( pxEventBits != NULL )
 		{
 			pxEventBits->uxEventBits = 0;
-			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+			prvInitialiseWaitLists( pxEventBits );
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
@@ -229,7 +270,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -384,7 +425,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -518,87 +559,63 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t const * pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+EventBits_t uxBitsToClear = 0;
 EventGroup_t *pxEventBits = xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
-
 		/* Set the bits. */
 		pxEventBits->uxEventBits |= uxBitsToSet;
 
 		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
+		#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
 		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
-
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		EventBits_t uxIndexedBits = uxBitsToSet & eventINDEXED_BITS;
+		UBaseType_t uxBit;
+
+			/* The wait condition of a blocked task was not met when it blocked,
+			so it can only be met now if one of the bits it waits for is being
+			set.  Only the lists of the bits being set are therefore looked at,
+			and all the tasks on them are unblocked. */
+			for( uxBit = 0; uxIndexedBits != ( EventBits_t ) 0; uxBit++ )
 			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+				if( ( uxIndexedBits & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 )
 				{
-					xMatchFound = pdTRUE;
+					( void ) prvUnblockMatchingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBit[ uxBit ] ), &uxBitsToClear );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				uxIndexedBits >>= 1;
 			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+
+			/* The same applies to the tasks waiting for several bits, which
+			are only scanned if any of the bits they wait for is being set.  The
+			scan also drops the bits of tasks that have timed out from the
+			summary. */
+			if( ( uxBitsToSet & pxEventBits->uxBitsWaitedFor ) != ( EventBits_t ) 0 )
 			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
+				pxEventBits->uxBitsWaitedFor = prvUnblockMatchingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxBitsToClear );
 			}
 			else
 			{
-				/* Need all bits to be set, but not all the bits were set. */
-			}
-
-			if( xMatchFound != pdFALSE )
-			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-				{
-					uxBitsToClear |= uxBitsWaitedFor;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				mtCOVERAGE_TEST_MARKER();
 			}
-
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
 		}
+		#else
+		{
+			( void ) prvUnblockMatchingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxBitsToClear );
+		}
+		#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
 
 		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
 		bit was set in the control word. */
@@ -613,19 +630,23 @@ BaseType_t xMatchFound = pdFALSE;
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = xEventGroup;
-const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
-		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+		prvUnblockAllTasks( &( pxEventBits->xTasksWaitingForBits ) );
+
+		#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
 		{
-			/* Unblock the task, returning 0 as the event list is being deleted
-			and cannot therefore have any bits set. */
-			configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-			vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+		UBaseType_t uxBit;
+
+			for( uxBit = 0; uxBit < ( UBaseType_t ) configEVENT_GROUP_INDEXED_BITS; uxBit++ )
+			{
+				prvUnblockAllTasks( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+			}
 		}
+		#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
 
 		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
 		{
@@ -703,6 +724,124 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+static void prvInitialiseWaitLists( EventGroup_t *pxEventBits )
+{
+	vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	{
+	UBaseType_t uxBit;
+
+		pxEventBits->uxBitsWaitedFor = 0;
+		for( uxBit = 0; uxBit < ( UBaseType_t ) configEVENT_GROUP_INDEXED_BITS; uxBit++ )
+		{
+			vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+		}
+	}
+	#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+}
+/*-----------------------------------------------------------*/
+
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor )
+{
+List_t *pxList = &( pxEventBits->xTasksWaitingForBits );
+
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+	{
+	UBaseType_t uxBit = 0;
+
+		/* Waiting for any or for all bits is the same when only one bit is
+		waited for, so both kinds of waits can use the list of the bit. */
+		if( ( ( uxBitsToWaitFor & ( uxBitsToWaitFor - ( EventBits_t ) 1 ) ) == ( EventBits_t ) 0 ) && ( ( uxBitsToWaitFor & eventINDEXED_BITS ) != ( EventBits_t ) 0 ) )
+		{
+			while( ( uxBitsToWaitFor >> uxBit ) != ( EventBits_t ) 1 )
+			{
+				uxBit++;
+			}
+
+			pxList = &( pxEventBits->xTasksWaitingForBit[ uxBit ] );
+		}
+		else
+		{
+			pxEventBits->uxBitsWaitedFor |= uxBitsToWaitFor;
+		}
+	}
+	#else
+	{
+		( void ) uxBitsToWaitFor;
+	}
+	#endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+	return pxList;
+}
+/*-----------------------------------------------------------*/
+
+static EventBits_t prvUnblockMatchingTasks( EventGroup_t *pxEventBits, List_t const *pxList, EventBits_t *puxBitsToClear )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+EventBits_t uxBitsWaitedFor, uxControlBits, uxBitsStillWaitedFor = 0;
+BaseType_t xMatchFound;
+
+	pxListItem = listGET_HEAD_ENTRY( pxList );
+
+	while( pxListItem != pxListEnd )
+	{
+		pxNext = listGET_NEXT( pxListItem );
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+
+		/* Split the bits waited for from the control bits. */
+		uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+		xMatchFound = prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE );
+
+		if( xMatchFound != pdFALSE )
+		{
+			/* The bits match.  Should the bits be cleared on exit? */
+			if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+			{
+				*puxBitsToClear |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Store the actual event flag value in the task's event list
+			item before removing the task from the event list.  The
+			eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+			that is was unblocked due to its required bits matching, rather
+			than because it timed out. */
+			vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+		}
+		else
+		{
+			uxBitsStillWaitedFor |= uxBitsWaitedFor;
+		}
+
+		/* Move onto the next list item.  Note pxListItem->pxNext is not
+		used here as the list item may have been removed from the event list
+		and inserted into the ready/pending reading list. */
+		pxListItem = pxNext;
+	}
+
+	return uxBitsStillWaitedFor;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnblockAllTasks( List_t const *pxList )
+{
+	while( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+	{
+		/* Unblock the task, returning 0 as the event list is being deleted
+		and cannot therefore have any bits set. */
+		configASSERT( pxList->xListEnd.pxNext != ( const ListItem_t * ) &( pxList->xListEnd ) );
+		vTaskRemoveFromUnorderedEventList( pxList->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+	}
+}
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
@@ -160,6 +160,10 @@ extern "C" {
 	#define INCLUDE_uxTaskGetStackHighWaterMark2 0
 #endif
 
+#ifndef INCLUDE_uxTaskGetStackStats
+	#define INCLUDE_uxTaskGetStackStats 0
+#endif
+
 #ifndef INCLUDE_eTaskGetState
 	#define INCLUDE_eTaskGetState 0
 #endif
@@ -296,6 +300,45 @@ extern "C" {
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#ifndef configTRACE_RECORDER_BUFFER_LENGTH
+	#define configTRACE_RECORDER_BUFFER_LENGTH 256
+#endif
+
+#ifndef configTRACE_RECORDER_MAX_OBJECTS
+	#define configTRACE_RECORDER_MAX_OBJECTS 16
+#endif
+
+/* The trace recorder defines the trace macros, so it has to be included before
+the unused ones are removed below. */
+#if( configUSE_TRACE_RECORDER == 1 )
+	#include "trace_recorder.h"
+#endif
+
+#ifndef configUSE_CRITICAL_PROFILER
+	#define configUSE_CRITICAL_PROFILER 0
+#endif
+
+#ifndef configCRITICAL_PROFILER_MAX_SITES
+	#define configCRITICAL_PROFILER_MAX_SITES 64
+#endif
+
+#ifndef configCRITICAL_PROFILER_BUCKETS
+	#define configCRITICAL_PROFILER_BUCKETS 16
+#endif
+
+#ifndef configCRITICAL_PROFILER_BUCKET_SHIFT
+	#define configCRITICAL_PROFILER_BUCKET_SHIFT 4
+#endif
+
+/* The critical section profiler replaces the port critical section macros. */
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	#include "critical_profiler.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -714,6 +757,24 @@ extern "C" {
 
 #endif /* configGENERATE_RUN_TIME_STATS */
 
+#ifndef configRUN_TIME_COUNTER_TYPE
+	/* Type of the run time counter.  Can be set to uint64_t when the counter
+	would wrap too often at 32 bits. */
+	#define configRUN_TIME_COUNTER_TYPE uint32_t
+#endif
+
+#ifndef configRUN_TIME_STATS_LATENCY_BUCKETS
+	/* Number of buckets in the per task histogram of latencies between a task
+	being made ready and being switched in. */
+	#define configRUN_TIME_STATS_LATENCY_BUCKETS 16
+#endif
+
+#ifndef configRUN_TIME_STATS_LATENCY_SHIFT
+	/* Latencies below 2^configRUN_TIME_STATS_LATENCY_SHIFT run time counter
+	units fall into the first histogram bucket. */
+	#define configRUN_TIME_STATS_LATENCY_SHIFT 8
+#endif
+
 #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
 	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #endif
@@ -726,6 +787,14 @@ extern "C" {
 	#define portPRIVILEGE_BIT ( ( UBaseType_t ) 0x00 )
 #endif
 
+#ifndef configUSE_TASK_FPU_CONTROL
+	#define configUSE_TASK_FPU_CONTROL 0
+#endif
+
+#if( ( configUSE_TASK_FPU_CONTROL == 1 ) && !defined( portDROP_FPU_CONTEXT ) )
+	#error configUSE_TASK_FPU_CONTROL is set to 1 but the port does not define portDROP_FPU_CONTEXT() and portTASK_FPU_CONTEXT_SAVED().  Only ports for cores with lazy floating point context saving (e.g. ARM_CM4F) support it.
+#endif
+
 #ifndef portYIELD_WITHIN_API
 	#define portYIELD_WITHIN_API portYIELD
 #endif
@@ -810,6 +879,121 @@ extern "C" {
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
 #endif
 
+#ifndef configUSE_PRIORITY_BITMAP_TASK_SELECTION
+	#define configUSE_PRIORITY_BITMAP_TASK_SELECTION 0
+#endif
+
+#if( ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 ) && ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 ) )
+	#error configUSE_PRIORITY_BITMAP_TASK_SELECTION and configUSE_PORT_OPTIMISED_TASK_SELECTION cannot both be set to 1.
+#endif
+
+#ifndef configUSE_DELAYED_LIST_TIMING_WHEEL
+	#define configUSE_DELAYED_LIST_TIMING_WHEEL 0
+#endif
+
+#ifndef configTIMING_WHEEL_SIZE
+	#define configTIMING_WHEEL_SIZE 32
+#endif
+
+#ifndef configUSE_TIMER_LIST_TIMING_WHEEL
+	#define configUSE_TIMER_LIST_TIMING_WHEEL 0
+#endif
+
+#ifndef configUSE_TIMER_LIST_HEAP
+	#define configUSE_TIMER_LIST_HEAP 0
+#endif
+
+#ifndef configTIMER_HEAP_LENGTH
+	#define configTIMER_HEAP_LENGTH 32
+#endif
+
+#if( ( configUSE_TIMER_LIST_TIMING_WHEEL == 1 ) && ( configUSE_TIMER_LIST_HEAP == 1 ) )
+	#error configUSE_TIMER_LIST_TIMING_WHEEL and configUSE_TIMER_LIST_HEAP cannot both be set to 1.
+#endif
+
+#ifndef configUSE_QUEUE_LOANS
+	#define configUSE_QUEUE_LOANS 0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_LOCK_FREE
+	#define configUSE_STREAM_BUFFER_LOCK_FREE 0
+#endif
+
+#ifndef configUSE_BLOCK_POOLS
+	#define configUSE_BLOCK_POOLS 0
+#endif
+
+#ifndef configUSE_SIZE_SPECIALISED_COPY
+	#define configUSE_SIZE_SPECIALISED_COPY 0
+#endif
+
+#ifndef portINLINE
+	#define portINLINE __inline
+#endif
+
+#if( configUSE_SIZE_SPECIALISED_COPY == 1 )
+	#include <string.h>
+
+	/* Copies queue items and stream buffer data.  Copies of the common small
+	sizes call memcpy() with a constant size, which the compiler replaces with a
+	few loads and stores, so only the other sizes pay for the function call. */
+	static portINLINE void vKernelCopyData( void *pvDestination, const void *pvSource, size_t xSize )
+	{
+		switch( xSize )
+		{
+			case 1U:
+				( void ) memcpy( pvDestination, pvSource, 1U );
+				break;
+
+			case 2U:
+				( void ) memcpy( pvDestination, pvSource, 2U );
+				break;
+
+			case 4U:
+				( void ) memcpy( pvDestination, pvSource, 4U );
+				break;
+
+			case 8U:
+				( void ) memcpy( pvDestination, pvSource, 8U );
+				break;
+
+			case 16U:
+				( void ) memcpy( pvDestination, pvSource, 16U );
+				break;
+
+			default:
+				( void ) memcpy( pvDestination, pvSource, xSize );
+				break;
+		}
+	}
+#endif /* configUSE_SIZE_SPECIALISED_COPY */
+
+/* Copies queue items and stream buffer data.  Can be defined by the
+application to use its own copy function. */
+#ifndef configCOPY_DATA
+	#if( configUSE_SIZE_SPECIALISED_COPY == 1 )
+		#define configCOPY_DATA( pvDestination, pvSource, xSize ) vKernelCopyData( ( pvDestination ), ( pvSource ), ( xSize ) )
+	#else
+		#define configCOPY_DATA( pvDestination, pvSource, xSize ) ( void ) memcpy( ( pvDestination ), ( pvSource ), ( xSize ) )
+	#endif
+#endif
+
+#ifndef configUSE_EVENT_GROUP_WAITER_INDEX
+	#define configUSE_EVENT_GROUP_WAITER_INDEX 0
+#endif
+
+/* The number of the lowest event bits that have their own list of waiting
+tasks when configUSE_EVENT_GROUP_WAITER_INDEX is 1.  Each of them adds a List_t
+to every event group, so small targets should only index the bits that many
+tasks wait for. */
+#ifndef configEVENT_GROUP_INDEXED_BITS
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define configEVENT_GROUP_INDEXED_BITS 8
+	#else
+		#define configEVENT_GROUP_INDEXED_BITS 24
+	#endif
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
@@ -826,6 +1010,11 @@ extern "C" {
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
 
+#ifndef portHAS_END_SCHEDULER
+	/* Most ports have nothing to return to and assert in vPortEndScheduler(). */
+	#define portHAS_END_SCHEDULER 0
+#endif
+
 #ifndef configSUPPORT_STATIC_ALLOCATION
 	/* Defaults to 0 for backward compatibility. */
 	#define configSUPPORT_STATIC_ALLOCATION 0
@@ -1121,7 +1310,8 @@ typedef struct xSTATIC_TCB
 		void			*pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
 	#endif
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulDummy16;
+		configRUN_TIME_COUNTER_TYPE	ulDummy16[ 3 ];
+		uint32_t		ulDummy23[ 1 + configRUN_TIME_STATS_LATENCY_BUCKETS ];
 	#endif
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		struct	_reent	xDummy17;
@@ -1183,6 +1373,10 @@ typedef struct xSTATIC_QUEUE
 		uint8_t ucDummy9;
 	#endif
 
+	#if ( configUSE_QUEUE_LOANS == 1 )
+		void *pvDummy10[ 2 ];
+	#endif
+
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -1205,6 +1399,11 @@ typedef struct xSTATIC_EVENT_GROUP
 	TickType_t xDummy1;
 	StaticList_t xDummy2;
 
+	#if( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+		TickType_t xDummy5;
+		StaticList_t xDummy6[ configEVENT_GROUP_INDEXED_BITS ];
+	#endif
+
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy3;
 	#endif
@@ -1239,6 +1438,10 @@ typedef struct xSTATIC_TIMER
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t		uxDummy7;
 	#endif
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+		void			*pvDummy9;
+		UBaseType_t		uxDummy10[ 2 ];
+	#endif
 	uint8_t 			ucDummy8;
 
 } StaticTimer_t;
@@ -1270,6 +1473,29 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the block pool structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a block pool then the size of the block pool object needs to be know.
+ * The StaticBlockPool_t structure below is provided for this purpose.  Its
+ * size and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_BLOCK_POOL
+{
+	StaticQueue_t xDummy1;
+	void *pvDummy2[ 3 ];
+	size_t xDummy3;
+	UBaseType_t uxDummy4[ 5 ];
+	uint8_t ucDummy5;
+} StaticBlockPool_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,193 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include block_pool.h"
+#endif
+
+/*
+ * Fixed size block pool.
+ *
+ * A block pool hands out blocks of one size from a storage area provided when
+ * the pool is created.  Free blocks are kept in a singly linked list threaded
+ * through the blocks themselves, so allocating and freeing a block take
+ * constant time and the pool can never fragment.  Blocks can be allocated and
+ * freed from tasks and interrupts.  A task allocating from an exhausted pool
+ * can block until another task or interrupt frees a block, the waiting tasks
+ * are served in priority order.
+ *
+ * Block pools are meant for objects that are created and destroyed at a high
+ * rate (e.g. messages passed between tasks), which would otherwise fragment a
+ * general purpose heap and make the time of allocation unpredictable.
+ *
+ * Requires configUSE_BLOCK_POOLS, configSUPPORT_STATIC_ALLOCATION and
+ * configUSE_COUNTING_SEMAPHORES to be set to 1 in FreeRTOSConfig.h.
+ */
+
+#if( configUSE_BLOCK_POOLS == 1 )
+
+#if( configSUPPORT_STATIC_ALLOCATION != 1 )
+	#error configSUPPORT_STATIC_ALLOCATION must be set to 1 to use block pools.
+#endif
+
+#if( configUSE_COUNTING_SEMAPHORES != 1 )
+	#error configUSE_COUNTING_SEMAPHORES must be set to 1 to use block pools.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Type by which block pools are referenced.  For example, a call to
+ * xBlockPoolCreateStatic() returns a BlockPoolHandle_t variable that can then
+ * be used as a parameter to pvBlockPoolAllocate(), vBlockPoolFree(), etc.
+ */
+struct BlockPoolDefinition;
+typedef struct BlockPoolDefinition * BlockPoolHandle_t;
+
+/*
+ * Statistics of a block pool, filled in by vBlockPoolGetStats().
+ */
+typedef struct xBLOCK_POOL_STATS
+{
+	size_t xBlockSize;					/*< The size of a single block in bytes, after rounding up to the alignment. */
+	UBaseType_t uxBlockCount;			/*< The number of blocks in the pool. */
+	UBaseType_t uxBlocksAvailable;		/*< The number of blocks that are currently free. */
+	UBaseType_t uxMinimumEverAvailable;	/*< The lowest number of free blocks since the pool was created. */
+	UBaseType_t uxAllocations;			/*< The number of successful allocations. */
+	UBaseType_t uxFailedAllocations;	/*< The number of allocations that failed because the pool was exhausted. */
+} BlockPoolStats_t;
+
+/*
+ * The size of a block in a pool created for blocks of xBlockSize bytes.  The
+ * size is rounded up, so every block can hold a pointer and is aligned to
+ * portBYTE_ALIGNMENT.
+ */
+#define blockpoolBLOCK_SIZE( xBlockSize ) ( ( ( ( xBlockSize ) < sizeof( void * ) ? sizeof( void * ) : ( xBlockSize ) ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*
+ * The size of the storage area required by a pool of uxBlockCount blocks of
+ * xBlockSize bytes.
+ */
+#define blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) ( blockpoolBLOCK_SIZE( xBlockSize ) * ( size_t ) ( uxBlockCount ) )
+
+/*
+ * Creates a block pool using the memory provided by the caller.
+ *
+ * @param xBlockSize The size of a single block in bytes.  It is rounded up
+ * with blockpoolBLOCK_SIZE().
+ *
+ * @param uxBlockCount The number of blocks in the pool.
+ *
+ * @param pucPoolStorageArea Must point to a buffer of at least
+ * blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) bytes aligned to
+ * portBYTE_ALIGNMENT.  The blocks are carved out of this buffer.
+ *
+ * @param pxStaticBlockPool Must point to a variable of type StaticBlockPool_t,
+ * which will be used to hold the pool's data structure.
+ *
+ * @return The handle of the created pool, or NULL if pucPoolStorageArea or
+ * pxStaticBlockPool is NULL.
+ */
+BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize,
+										  UBaseType_t uxBlockCount,
+										  uint8_t *pucPoolStorageArea,
+										  StaticBlockPool_t *pxStaticBlockPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Creates a block pool, allocating its data structure and storage area with a
+ * single call to pvPortMalloc().  The parameters are the same as for
+ * xBlockPoolCreateStatic().
+ *
+ * @return The handle of the created pool, or NULL if there was not enough heap
+ * memory available.
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Deletes the pool.  All blocks must have been returned to the pool and no
+ * task may be blocked on it.
+ */
+void vBlockPoolDelete( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * pvBlockPoolAllocate() takes a free block from the pool.
+ * pvBlockPoolAllocateFromISR() is the equivalent that can be used from an ISR,
+ * it never blocks.
+ *
+ * @param xBlockPool The handle of the pool.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state to wait for a block to be freed, if the pool is exhausted.
+ *
+ * @return Pointer to the block, or NULL if no block was freed before the
+ * timeout.
+ */
+void *pvBlockPoolAllocate( BlockPoolHandle_t xBlockPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void *pvBlockPoolAllocateFromISR( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * vBlockPoolFree() returns the block to the pool it was allocated from and
+ * unblocks the highest priority task waiting for a block, if any.
+ * vBlockPoolFreeFromISR() is the equivalent that can be used from an ISR.
+ *
+ * @param xBlockPool The handle of the pool.
+ *
+ * @param pvBlock The block allocated from the same pool.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if freeing the block
+ * unblocked a task with a priority higher than the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  Can be NULL.
+ */
+void vBlockPoolFree( BlockPoolHandle_t xBlockPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+void vBlockPoolFreeFromISR( BlockPoolHandle_t xBlockPool, void *pvBlock, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of free blocks in the pool.
+ */
+UBaseType_t uxBlockPoolBlocksAvailable( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fills in the statistics of the pool.  Can be called from tasks and ISRs.
+ */
+void vBlockPoolGetStats( BlockPoolHandle_t xBlockPool, BlockPoolStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* configUSE_BLOCK_POOLS */
+
+#endif /* BLOCK_POOL_H */
@@ -0,0 +1,261 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CRITICAL_PROFILER_H
+#define CRITICAL_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include critical_profiler.h"
+#endif
+
+/*
+ * Critical section profiler.
+ *
+ * The profiler replaces the port critical section macros (portENTER_CRITICAL(),
+ * portSET_INTERRUPT_MASK_FROM_ISR(), portDISABLE_INTERRUPTS() and their
+ * counterparts) with versions that timestamp the moment interrupts are masked
+ * and unmasked.  The outermost section is measured, nested sections are part
+ * of it.  For every section the profiler updates:
+ * - the longest section and the address of the code that started it,
+ * - a histogram of the section durations,
+ * - a table of call sites: the number of sections started at each of them,
+ *   their longest and their total duration.
+ * A call site is the address of the code that entered the section (i.e. the
+ * address following the call to vCriticalProfilerEnter() inlined into the
+ * function using taskENTER_CRITICAL()), which can be translated to the source
+ * line with the program image.
+ *
+ * Timestamps are taken with ulCriticalProfilerGetTimestamp(), which has to be
+ * provided by the application (or the platform).  It should read a cycle
+ * counter and must not use critical sections itself.
+ *
+ * All profiler data is held in a single, self-describing variable
+ * (xCriticalProfiler), which can be dumped by a debugger or by the application
+ * (see pvCriticalProfilerGetData()) and decoded on the host with
+ * tools/critical-profiler.py.
+ *
+ * The profiler is enabled by setting configUSE_CRITICAL_PROFILER to 1 in
+ * FreeRTOSConfig.h, in which case this file is included by FreeRTOS.h.  The
+ * bookkeeping is done with interrupts masked, so it extends the measured
+ * sections by a constant amount - the profiler is a diagnostic tool and
+ * should not be left enabled in builds used to measure throughput.
+ *
+ * Sections that end with a context switch (possible only on ports which
+ * switch tasks inside of critical sections, e.g. the Linux simulator) are
+ * measured up to the switch.
+ */
+
+#if( ( configCRITICAL_PROFILER_MAX_SITES & ( configCRITICAL_PROFILER_MAX_SITES - 1 ) ) != 0 )
+	#error configCRITICAL_PROFILER_MAX_SITES must be a power of two.
+#endif
+
+#ifndef portFORCE_INLINE
+	#define portFORCE_INLINE inline __attribute__(( always_inline ))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Value of ulMagic in the profiler header ("FRCP" in little endian). */
+#define profilerMAGIC		0x50435246UL
+
+/* Version of the profiler data layout. */
+#define profilerVERSION		1U
+
+/*
+ * Entry of the call site table.
+ */
+typedef struct xCRITICAL_PROFILER_SITE
+{
+	uint32_t ulSite;				/*< The address of the code that entered the section, 0 for unused entries. */
+	uint32_t ulCount;				/*< The number of sections started at the site. */
+	uint32_t ulMaxDuration;			/*< The longest section started at the site, in timestamp units. */
+	uint32_t ulReserved;			/*< Unused, keeps the total duration aligned. */
+	uint64_t ullTotalDuration;		/*< The sum of the durations of the sections started at the site, in timestamp units. */
+} CriticalProfilerSite_t;
+
+/*
+ * Header at the beginning of the profiler data, which describes the layout of
+ * the rest of the data for the host tools.
+ */
+typedef struct xCRITICAL_PROFILER_HEADER
+{
+	uint32_t ulMagic;					/*< profilerMAGIC. */
+	uint16_t usVersion;					/*< profilerVERSION. */
+	uint16_t usHeaderSize;				/*< sizeof( CriticalProfilerHeader_t ). */
+	uint16_t usSiteSize;				/*< sizeof( CriticalProfilerSite_t ). */
+	uint16_t usBucketCount;				/*< The number of buckets in the histogram. */
+	uint32_t ulSiteCount;				/*< The number of entries in the call site table. */
+	uint32_t ulBucketShift;				/*< The first histogram bucket counts sections shorter than 2^ulBucketShift timestamp units. */
+	uint32_t ulEnabled;					/*< Non-zero if the sections are recorded. */
+	uint64_t ullTimestampFrequency;		/*< The number of timestamp units per second. */
+	uint32_t ulReference;				/*< The address of vCriticalProfilerReset(), from which the host tools find the load address of the program. */
+	uint32_t ulSections;				/*< The number of sections recorded (modulo 2^32). */
+	uint32_t ulMissedSites;				/*< The number of sections not counted in the call site table, because it was full. */
+	uint32_t ulMaxDuration;				/*< The longest section, in timestamp units. */
+	uint32_t ulMaxSite;					/*< The address of the code that entered the longest section. */
+	uint32_t ulReserved;				/*< Unused, keeps the header size a multiple of 8 bytes. */
+} CriticalProfilerHeader_t;
+
+/*
+ * The profiler data: header, histogram and the call site table, in this
+ * order and without padding in between.
+ */
+typedef struct xCRITICAL_PROFILER
+{
+	CriticalProfilerHeader_t xHeader;
+	uint32_t ulHistogram[ configCRITICAL_PROFILER_BUCKETS ];
+	CriticalProfilerSite_t xSites[ configCRITICAL_PROFILER_MAX_SITES ];
+} CriticalProfiler_t;
+
+extern CriticalProfiler_t xCriticalProfiler;
+
+/*
+ * Returns the current timestamp.  Must be provided by the application (or the
+ * platform).  It is called with interrupts masked, so it must not use critical
+ * sections.  Only differences between timestamps are used, so the value may
+ * wrap around.
+ */
+uint32_t ulCriticalProfilerGetTimestamp( void );
+
+/*
+ * Returns the number of timestamp units per second.  Must be provided by the
+ * application (or the platform).
+ */
+uint64_t ullCriticalProfilerGetTimestampFrequency( void );
+
+/*
+ * vCriticalProfilerStart() resumes and vCriticalProfilerStop() suspends
+ * recording of the sections.  The profiler is started when the program
+ * starts.  It should be stopped before its data is read, to get a consistent
+ * snapshot.  Both can be called from tasks and ISRs.
+ */
+void vCriticalProfilerStart( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerStop( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Discards all recorded data, e.g. to measure only the steady state of the
+ * application.
+ */
+void vCriticalProfilerReset( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the profiler data, which can be written to a file or sent to the
+ * host for decoding.
+ *
+ * @param pxSize Set to the size of the data in bytes.
+ */
+const void *pvCriticalProfilerGetData( size_t *pxSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Hooks called by the critical section macros below and by the scheduler, not
+ * intended to be called directly by the application.  All of them are called
+ * with interrupts masked.
+ */
+void vCriticalProfilerEnter( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerExit( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerDisable( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerEnable( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerTaskSwitch( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * The port macros are expanded inside these functions before they are
+ * replaced below, so the functions call the original port implementation.
+ * They are always inlined, so the address of the call to the hook identifies
+ * the code using the critical section.
+ */
+portFORCE_INLINE static void vCriticalProfilerPortEnterCritical( void )
+{
+	portENTER_CRITICAL();
+	vCriticalProfilerEnter();
+}
+
+portFORCE_INLINE static void vCriticalProfilerPortExitCritical( void )
+{
+	vCriticalProfilerExit();
+	portEXIT_CRITICAL();
+}
+
+portFORCE_INLINE static UBaseType_t uxCriticalProfilerPortSetInterruptMask( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+	vCriticalProfilerEnter();
+	return uxSavedInterruptStatus;
+}
+
+portFORCE_INLINE static void vCriticalProfilerPortClearInterruptMask( UBaseType_t uxSavedInterruptStatus )
+{
+	vCriticalProfilerExit();
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+
+portFORCE_INLINE static void vCriticalProfilerPortDisableInterrupts( void )
+{
+	portDISABLE_INTERRUPTS();
+	vCriticalProfilerDisable();
+}
+
+portFORCE_INLINE static void vCriticalProfilerPortEnableInterrupts( void )
+{
+	vCriticalProfilerEnable();
+	portENABLE_INTERRUPTS();
+}
+
+/* Used by the profiler itself, which must not be profiled. */
+portFORCE_INLINE static UBaseType_t uxCriticalProfilerMaskInterrupts( void )
+{
+	return ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+}
+
+portFORCE_INLINE static void vCriticalProfilerUnmaskInterrupts( UBaseType_t uxSavedInterruptStatus )
+{
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+
+#undef portENTER_CRITICAL
+#undef portEXIT_CRITICAL
+#undef portSET_INTERRUPT_MASK_FROM_ISR
+#undef portCLEAR_INTERRUPT_MASK_FROM_ISR
+#undef portDISABLE_INTERRUPTS
+#undef portENABLE_INTERRUPTS
+
+#define portENTER_CRITICAL()					vCriticalProfilerPortEnterCritical()
+#define portEXIT_CRITICAL()						vCriticalProfilerPortExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxCriticalProfilerPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vCriticalProfilerPortClearInterruptMask( x )
+#define portDISABLE_INTERRUPTS()				vCriticalProfilerPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()					vCriticalProfilerPortEnableInterrupts()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRITICAL_PROFILER_H */
@@ -595,6 +595,18 @@ BaseType_t xHigherPriorityTaskWoken = pdFALSE;  // Initialised to pdFALSE.
  */
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 
+/*
+ * Scatter-gather versions of xMessageBufferSend(), xMessageBufferSendFromISR(),
+ * xMessageBufferReceive() and xMessageBufferReceiveFromISR().  All the
+ * segments passed to a send function form a single message, and a received
+ * message is scattered into the segments passed to a receive function.  See
+ * xStreamBufferSendV() and xStreamBufferReceiveV() in stream_buffer.h.
+ */
+#define xMessageBufferSendV( xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait ) xStreamBufferSendV( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait )
+#define xMessageBufferSendVFromISR( xMessageBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken ) xStreamBufferSendVFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken )
+#define xMessageBufferReceiveV( xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait ) xStreamBufferReceiveV( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait )
+#define xMessageBufferReceiveVFromISR( xMessageBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken ) xStreamBufferReceiveVFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken )
+
 /**
  * message_buffer.h
  *
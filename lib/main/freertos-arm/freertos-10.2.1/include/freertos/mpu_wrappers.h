@@ -68,6 +68,8 @@ only for ports that are using the MPU. */
 		#define xTaskGetHandle							MPU_xTaskGetHandle
 		#define uxTaskGetStackHighWaterMark				MPU_uxTaskGetStackHighWaterMark
 		#define uxTaskGetStackHighWaterMark2			MPU_uxTaskGetStackHighWaterMark2
+		#define uxTaskGetStackStats						MPU_uxTaskGetStackStats
+		#define xTaskGetStackStatsByIndex				MPU_xTaskGetStackStatsByIndex
 		#define vTaskSetApplicationTaskTag				MPU_vTaskSetApplicationTaskTag
 		#define xTaskGetApplicationTaskTag				MPU_xTaskGetApplicationTaskTag
 		#define vTaskSetThreadLocalStoragePointer		MPU_vTaskSetThreadLocalStoragePointer
@@ -75,6 +77,7 @@ only for ports that are using the MPU. */
 		#define xTaskCallApplicationTaskHook			MPU_xTaskCallApplicationTaskHook
 		#define xTaskGetIdleTaskHandle					MPU_xTaskGetIdleTaskHandle
 		#define uxTaskGetSystemState					MPU_uxTaskGetSystemState
+		#define uxTaskGetRunTimeStats					MPU_uxTaskGetRunTimeStats
 		#define vTaskList								MPU_vTaskList
 		#define vTaskGetRunTimeStats					MPU_vTaskGetRunTimeStats
 		#define xTaskGetIdleRunTimeCounter				MPU_xTaskGetIdleRunTimeCounter
@@ -118,7 +118,7 @@ extern "C" {
 	#endif
 #endif
 
-/* Used by heap_5.c. */
+/* Used by heap_5.c, heap_first_fit.c and heap_tlsf.c. */
 typedef struct HeapRegion
 {
 	uint8_t *pucStartAddress;
@@ -126,7 +126,8 @@ typedef struct HeapRegion
 } HeapRegion_t;
 
 /*
- * Used to define multiple heap regions for use by heap_5.c.  This function
+ * Used to define multiple heap regions for use by heap_5.c, heap_first_fit.c
+ * and heap_tlsf.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
  * queue, semaphore, mutex, software timer, event group, etc. will result in
  * pvPortMalloc being called.
@@ -134,10 +135,20 @@ typedef struct HeapRegion
  * pxHeapRegions passes in an array of HeapRegion_t structures - each of which
  * defines a region of memory that can be used as the heap.  The array is
  * terminated by a HeapRegions_t structure that has a size of 0.  The region
- * with the lowest start address must appear first in the array.
+ * with the lowest start address must appear first in the array (heap_5.c
+ * only, heap_first_fit.c and heap_tlsf.c accept the regions in any order).
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called by heap_first_fit.c and heap_tlsf.c on the first call to
+ * pvPortMalloc() if vPortDefineHeapRegions() was not called before.  The
+ * application has to set *ppxHeapRegions to an array of HeapRegion_t
+ * structures terminated in the same way as for vPortDefineHeapRegions(), which
+ * is then used to define the heap regions.
+ */
+void vApplicationGetHeapRegions( const HeapRegion_t **ppxHeapRegions );
+
 
 /*
  * Map to the memory management routines required for the port.
@@ -148,6 +159,13 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns the number of bytes that can be used in the block returned by
+ * pvPortMalloc(), which is at least the requested size.  Only provided by
+ * heap_first_fit.c and heap_tlsf.c.
+ */
+size_t xPortGetUsableSize( void *pv ) PRIVILEGED_FUNCTION;
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -0,0 +1,165 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PRIORITY_BITMAP_H
+#define PRIORITY_BITMAP_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include priority_bitmap.h"
+#endif
+
+/*
+ * Bitmap of the ready priorities used by the generic task selection when
+ * configUSE_PRIORITY_BITMAP_TASK_SELECTION is set to 1.  Every priority is
+ * represented by a single bit, so finding the highest ready priority takes
+ * constant time, regardless of configMAX_PRIORITIES and of the port:
+ * - up to 32 priorities a single 32-bit word is used,
+ * - above 32 priorities an additional 32-bit word marks which of the priority
+ *   words are non-zero, which allows up to 1024 priorities.
+ *
+ * The most significant set bit is found with the count leading zeros
+ * instruction where the compiler and the target provide one, or with a de
+ * Bruijn sequence lookup otherwise (e.g. ARMv6-M cores like Cortex-M0).
+ */
+
+#if( configMAX_PRIORITIES > 1024 )
+	#error configUSE_PRIORITY_BITMAP_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024.
+#endif
+
+#ifndef configPRIORITY_BITMAP_USE_CLZ
+	#if defined( __GNUC__ ) && ( !defined( __arm__ ) || defined( __ARM_FEATURE_CLZ ) )
+		#define configPRIORITY_BITMAP_USE_CLZ 1
+	#else
+		#define configPRIORITY_BITMAP_USE_CLZ 0
+	#endif
+#endif
+
+#define prioBITS_PER_WORD	( 32U )
+#define prioWORD_COUNT		( ( configMAX_PRIORITIES + 31 ) / 32 )
+
+typedef struct xPRIORITY_BITMAP
+{
+	#if( prioWORD_COUNT > 1 )
+		uint32_t ulWordMask;				/*< Bit n is set if ulWords[ n ] is not zero. */
+	#endif
+	uint32_t ulWords[ prioWORD_COUNT ];		/*< Bit n of word w is set if priority ( w * 32 + n ) has ready tasks. */
+} PriorityBitmap_t;
+
+/*
+ * Returns the index of the most significant set bit.  ulValue must not be 0.
+ */
+static inline UBaseType_t uxPriorityBitmapFindMsb( uint32_t ulValue )
+{
+	#if( configPRIORITY_BITMAP_USE_CLZ == 1 )
+	{
+		return ( UBaseType_t ) ( 31U - ( uint32_t ) __builtin_clz( ulValue ) );
+	}
+	#else
+	{
+	static const uint8_t ucDeBruijnMsbTable[ 32 ] =
+	{
+		0U, 9U, 1U, 10U, 13U, 21U, 2U, 29U, 11U, 14U, 16U, 18U, 22U, 25U, 3U, 30U,
+		8U, 12U, 20U, 28U, 15U, 17U, 24U, 7U, 19U, 27U, 23U, 6U, 26U, 5U, 4U, 31U
+	};
+
+		/* Propagate the most significant bit to all lower bits, so the value
+		becomes ( 2^( n + 1 ) - 1 ).  Multiplied by the de Bruijn constant it
+		gives a unique value in the top 5 bits for every n. */
+		ulValue |= ulValue >> 1;
+		ulValue |= ulValue >> 2;
+		ulValue |= ulValue >> 4;
+		ulValue |= ulValue >> 8;
+		ulValue |= ulValue >> 16;
+
+		return ( UBaseType_t ) ucDeBruijnMsbTable[ ( uint32_t ) ( ulValue * 0x07C4ACDDUL ) >> 27 ];
+	}
+	#endif
+}
+
+/*
+ * Marks uxPriority as having ready tasks.
+ */
+static inline void vPriorityBitmapSet( PriorityBitmap_t * const pxBitmap, UBaseType_t uxPriority )
+{
+	#if( prioWORD_COUNT > 1 )
+	{
+	const UBaseType_t uxWord = uxPriority / prioBITS_PER_WORD;
+
+		pxBitmap->ulWords[ uxWord ] |= ( uint32_t ) 1U << ( uxPriority % prioBITS_PER_WORD );
+		pxBitmap->ulWordMask |= ( uint32_t ) 1U << uxWord;
+	}
+	#else
+	{
+		pxBitmap->ulWords[ 0 ] |= ( uint32_t ) 1U << uxPriority;
+	}
+	#endif
+}
+
+/*
+ * Marks uxPriority as having no ready tasks.
+ */
+static inline void vPriorityBitmapClear( PriorityBitmap_t * const pxBitmap, UBaseType_t uxPriority )
+{
+	#if( prioWORD_COUNT > 1 )
+	{
+	const UBaseType_t uxWord = uxPriority / prioBITS_PER_WORD;
+
+		pxBitmap->ulWords[ uxWord ] &= ~( ( uint32_t ) 1U << ( uxPriority % prioBITS_PER_WORD ) );
+
+		if( pxBitmap->ulWords[ uxWord ] == 0U )
+		{
+			pxBitmap->ulWordMask &= ~( ( uint32_t ) 1U << uxWord );
+		}
+	}
+	#else
+	{
+		pxBitmap->ulWords[ 0 ] &= ~( ( uint32_t ) 1U << uxPriority );
+	}
+	#endif
+}
+
+/*
+ * Returns the highest priority marked in the bitmap.  At least one priority
+ * must be marked, which is always true once the idle task has been created.
+ */
+static inline UBaseType_t uxPriorityBitmapGetHighest( const PriorityBitmap_t * const pxBitmap )
+{
+	#if( prioWORD_COUNT > 1 )
+	{
+	const UBaseType_t uxWord = uxPriorityBitmapFindMsb( pxBitmap->ulWordMask );
+
+		return ( uxWord * prioBITS_PER_WORD ) + uxPriorityBitmapFindMsb( pxBitmap->ulWords[ uxWord ] );
+	}
+	#else
+	{
+		return uxPriorityBitmapFindMsb( pxBitmap->ulWords[ 0 ] );
+	}
+	#endif
+}
+
+#endif /* PRIORITY_BITMAP_H */
@@ -1384,6 +1384,121 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/*
+ * xQueueSendMultiple() posts up to uxItemCount items to the back of a queue
+ * within a single critical section, and unblocks the tasks waiting to receive
+ * from the queue only once for the whole batch.  The items are read from
+ * consecutive locations starting at pvItemsToQueue.
+ *
+ * The call blocks only until at least one item can be posted.  Then all items
+ * that fit into the queue are posted and the rest is left to the caller.
+ *
+ * xQueueSendMultipleFromISR() is the equivalent that can be used from an ISR.
+ * Both functions cannot be used with semaphores.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to the array of items to be placed on the
+ * queue.
+ *
+ * @param uxItemCount The number of items in the array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it already be
+ * full.
+ *
+ * @return The number of items posted, which can be lower than uxItemCount, or
+ * errQUEUE_FULL (zero) if no item could be posted.
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * xQueueReceiveMultiple() receives up to uxMaxItems items from a queue within
+ * a single critical section, and unblocks the tasks waiting to send to the
+ * queue only once for the whole batch.  The items are written to consecutive
+ * locations starting at pvBuffer.
+ *
+ * The call blocks only until at least one item is available.  Then all
+ * available items up to uxMaxItems are received.
+ *
+ * xQueueReceiveMultipleFromISR() is the equivalent that can be used from an
+ * ISR.  Both functions cannot be used with semaphores.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  It must be able to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty at the time of the
+ * call.
+ *
+ * @return The number of items received, or errQUEUE_EMPTY (zero) if no item
+ * was available.
+ */
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * xQueueAcquireSendSlot() and xQueueCommitSend() post an item to the back of a
+ * queue without copying it.  xQueueAcquireSendSlot() loans the next free slot
+ * of the queue storage area to the calling task, which writes the item
+ * directly into it and then calls xQueueCommitSend() to make the item
+ * available to the receivers.
+ *
+ * Only one send slot of a queue can be loaned at a time.  Until it is
+ * committed the queue appears full to all other senders, so the slot should be
+ * held only for as long as it takes to fill it.
+ *
+ * configUSE_QUEUE_LOANS must be set to 1 in FreeRTOSConfig.h for these
+ * functions to be available.  They cannot be used with semaphores.
+ *
+ * @param xQueue The handle to the queue on which the item is to be posted.
+ *
+ * @param ppvSlot Set to the slot in which the item of the queue item size has
+ * to be written.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a free slot, should the queue be full or its slot be already
+ * loaned.
+ *
+ * @return pdPASS if the slot was loaned, otherwise errQUEUE_FULL.
+ */
+BaseType_t xQueueAcquireSendSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueCommitSend( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * xQueueAcquireReceiveSlot() and xQueueReleaseReceive() receive an item from
+ * a queue without copying it.  xQueueAcquireReceiveSlot() loans the slot of the
+ * next item in the queue storage area to the calling task, which reads the
+ * item in place and then calls xQueueReleaseReceive() to remove it from the
+ * queue.
+ *
+ * Only one receive slot of a queue can be loaned at a time.  Until it is
+ * released the queue appears empty to all other receivers and items cannot be
+ * sent to its front or overwritten, so the slot should be held only for as
+ * long as it takes to process the item.
+ *
+ * configUSE_QUEUE_LOANS must be set to 1 in FreeRTOSConfig.h for these
+ * functions to be available.  They cannot be used with semaphores.
+ *
+ * @param xQueue The handle to the queue from which the item is to be received.
+ *
+ * @param ppvSlot Set to the slot holding the received item.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item, should the queue be empty or its next item be already
+ * loaned.
+ *
+ * @return pdPASS if the slot was loaned, otherwise errQUEUE_EMPTY.
+ */
+BaseType_t xQueueAcquireReceiveSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
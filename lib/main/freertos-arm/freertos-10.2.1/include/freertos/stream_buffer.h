@@ -64,6 +64,18 @@ extern "C" {
 struct StreamBufferDef_t;
 typedef struct StreamBufferDef_t * StreamBufferHandle_t;
 
+/**
+ * One of the segments passed to the scatter-gather functions
+ * xStreamBufferSendV(), xStreamBufferReceiveV() and their FromISR() versions.
+ * The send functions only read the data, so the segments can describe
+ * constant data.
+ */
+typedef struct xSTREAM_BUFFER_SEGMENT
+{
+	void *pvData;			/*< Start of the segment. */
+	size_t xLengthBytes;	/*< Number of bytes in the segment. */
+} StreamBufferSegment_t;
+
 
 /**
  * message_buffer.h
@@ -586,6 +598,136 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/*
+ * xStreamBufferSendV() is the scatter-gather version of xStreamBufferSend().
+ * The data is gathered from the xSegmentCount segments in pxSegments, in
+ * order, and written to the buffer as if it was stored in one contiguous
+ * block.  When used with a message buffer all the segments form one message,
+ * so a message can be framed from a separate header and payload without first
+ * copying them into a temporary buffer.  Empty segments are skipped.
+ *
+ * xStreamBufferSendVFromISR() is the equivalent that can be used from an ISR.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to which the data is
+ * being sent.
+ *
+ * @param pxSegments The segments holding the data to send.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param xTicksToWait The same as for xStreamBufferSend().
+ *
+ * @return The number of bytes written to the buffer, with the same meaning as
+ * for xStreamBufferSend().
+ */
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferSegment_t * const pxSegments,
+						   size_t xSegmentCount,
+						   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+								  const StreamBufferSegment_t * const pxSegments,
+								  size_t xSegmentCount,
+								  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * xStreamBufferReceiveV() is the scatter-gather version of
+ * xStreamBufferReceive().  The data read from the buffer is scattered into the
+ * xSegmentCount segments in pxSegments, in order, filling each one before
+ * moving to the next.  When used with a message buffer the total length of the
+ * segments must be large enough to hold the next message, otherwise the
+ * message is left in the buffer and 0 is returned.
+ *
+ * xStreamBufferReceiveVFromISR() is the equivalent that can be used from an
+ * ISR.
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which the data is
+ * being received.
+ *
+ * @param pxSegments The segments into which the received data is copied.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param xTicksToWait The same as for xStreamBufferReceive().
+ *
+ * @return The number of bytes read from the buffer, with the same meaning as
+ * for xStreamBufferReceive().
+ */
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+							  const StreamBufferSegment_t * const pxSegments,
+							  size_t xSegmentCount,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+									 const StreamBufferSegment_t * const pxSegments,
+									 size_t xSegmentCount,
+									 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * xStreamBufferReserve() and vStreamBufferCommit() write to a stream buffer
+ * without copying the data, for example by letting a DMA engine fill the
+ * storage area directly.  xStreamBufferReserve() returns the largest span of
+ * free bytes that starts at the current write position and does not wrap
+ * around the end of the storage area.  The data is written there by the
+ * caller, and vStreamBufferCommit() then makes the first xBytesWritten bytes of
+ * the span available to the reader.  The remaining free bytes, if any, can be
+ * reserved again after the commit.
+ *
+ * xStreamBufferReserveFromISR() and vStreamBufferCommitFromISR() are the
+ * equivalents that can be used from an ISR.  These functions cannot be used
+ * with message buffers.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppvData Set to the start of the reserved span.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state to wait for at least one byte to become free.
+ *
+ * @return The number of bytes in the reserved span, 0 if the buffer is full.
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 void ** const ppvData,
+							 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									void ** const ppvData ) PRIVILEGED_FUNCTION;
+void vStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+						  size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+void vStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								 size_t xBytesWritten,
+								 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * xStreamBufferPeek() and vStreamBufferConsume() read from a stream buffer
+ * without copying the data.  xStreamBufferPeek() returns the largest span of
+ * available bytes that starts at the current read position and does not wrap
+ * around the end of the storage area.  The data stays in the buffer until
+ * vStreamBufferConsume() frees the first xBytesRead bytes of the span for the
+ * writer.
+ *
+ * xStreamBufferPeekFromISR() and vStreamBufferConsumeFromISR() are the
+ * equivalents that can be used from an ISR.  These functions cannot be used
+ * with message buffers.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppvData Set to the start of the available span.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state to wait for data to become available.
+ *
+ * @return The number of bytes in the available span, 0 if the buffer is
+ * empty.
+ */
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer,
+						  void ** const ppvData,
+						  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferPeekFromISR( StreamBufferHandle_t xStreamBuffer,
+								 void ** const ppvData ) PRIVILEGED_FUNCTION;
+void vStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+						   size_t xBytesRead ) PRIVILEGED_FUNCTION;
+void vStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+								  size_t xBytesRead,
+								  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
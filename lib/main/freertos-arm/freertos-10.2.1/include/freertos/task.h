@@ -142,11 +142,44 @@ typedef struct xTASK_STATUS
 	eTaskState eCurrentState;		/* The state in which the task existed when the structure was populated. */
 	UBaseType_t uxCurrentPriority;	/* The priority at which the task was running (may be inherited) when the structure was populated. */
 	UBaseType_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
-	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+	configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;	/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Used with the uxTaskGetStackStats() function to return the stack usage of
+each task in the system. */
+typedef struct xTASK_STACK_STATS
+{
+	TaskHandle_t xHandle;							/* The handle of the task to which the rest of the information in the structure relates. */
+	const char *pcTaskName;							/* A pointer to the task's name.  This value will be invalid if the task was deleted since the structure was populated! */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	StackType_t *pxStackBase;						/* Points to the lowest address of the task's stack area. */
+	configSTACK_DEPTH_TYPE usStackDepth;			/* The size of the task's stack area, in words. */
+	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created, in words. */
+} TaskStackStats_t;
+
+/* Used with the uxTaskGetRunTimeStats() function to return the run time
+statistics of each task in the system. */
+typedef struct xTASK_RUN_TIME_STATS
+{
+	TaskHandle_t xHandle;							/* The handle of the task to which the rest of the information in the structure relates. */
+	const char *pcTaskName;							/* A pointer to the task's name.  This value will be invalid if the task was deleted since the structure was populated! */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;	/* The total time the task has spent in the Running state, in run time counter units. */
+	configRUN_TIME_COUNTER_TYPE ulMaxLatency;		/* The longest time between the task being made ready and being switched in, in run time counter units. */
+	uint32_t ulSwitchCount;							/* The number of times the task was switched in. */
+	uint32_t ulLatencyHistogram[ configRUN_TIME_STATS_LATENCY_BUCKETS ];	/* The number of switches in each latency range, see taskLATENCY_BUCKET_LIMIT(). */
+	#if( configUSE_TASK_FPU_CONTROL == 1 )
+		uint32_t ulFPUSwitchCount;					/* The number of times the task was switched out with its floating point context. */
+	#endif
+} TaskRunTimeStats_t;
+
+/*
+ * Upper (exclusive) limit of the latencies counted in the given bucket of
+ * TaskRunTimeStats_t.ulLatencyHistogram, in run time counter units.  The last
+ * bucket counts all latencies above the limit of the previous one.
+ */
+#define taskLATENCY_BUCKET_LIMIT( uxBucket ) ( ( ( configRUN_TIME_COUNTER_TYPE ) 1 ) << ( configRUN_TIME_STATS_LATENCY_SHIFT + ( uxBucket ) ) )
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -1366,6 +1399,21 @@ TickType_t xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>uint64_t ullTaskGetTickCount64( void );</PRE>
+ *
+ * @return The count of ticks since vTaskStartScheduler was called, extended
+ * to 64 bits with the number of tick count overflows.  Ticks that occurred
+ * while the scheduler was suspended are included.
+ *
+ * Can be called from tasks and ISRs.
+ *
+ * \defgroup ullTaskGetTickCount64 ullTaskGetTickCount64
+ * \ingroup TaskUtils
+ */
+uint64_t ullTaskGetTickCount64( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>uint16_t uxTaskGetNumberOfTasks( void );</PRE>
@@ -1463,6 +1511,50 @@ UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask ) PRIVILEGED_FUNCTIO
  */
 configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 
+/*
+ * INCLUDE_uxTaskGetStackStats must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  On ports where the stack grows down,
+ * configRECORD_STACK_HIGH_ADDRESS must also be set to 1, so the size of each
+ * stack is known.
+ *
+ * Populates a TaskStackStats_t structure with the size and the high water mark
+ * of the stack of each task in the system.  Unlike uxTaskGetSystemState(), it
+ * does not require configUSE_TRACE_FACILITY and does not read the run time
+ * counter.  The stacks are checked with the scheduler suspended, so the time
+ * the function takes grows with the amount of stack that was never used.
+ *
+ * @param pxStatsArray An array of TaskStackStats_t structures, one for each
+ * task.  The number of tasks can be obtained with uxTaskGetNumberOfTasks().
+ *
+ * @param uxArraySize The size of the array.  If it is smaller than the number
+ * of tasks in the system, nothing is written to the array and zero is
+ * returned.
+ *
+ * @return The number of TaskStackStats_t structures populated.
+ */
+UBaseType_t uxTaskGetStackStats( TaskStackStats_t * const pxStatsArray, const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+
+/*
+ * INCLUDE_uxTaskGetStackStats must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Same as uxTaskGetStackStats(), but checks the stack of a single task, the
+ * one at uxIndex in the order used by uxTaskGetStackStats().  The other tasks
+ * are only counted, so the scheduler is suspended for the time of checking one
+ * stack instead of all of them.  Calling it with consecutive indexes (e.g. one
+ * per idle hook call) spreads the checks over time.  Tasks changing their
+ * state between the calls change the order, so a task can be skipped or
+ * checked twice in one round.
+ *
+ * @param uxIndex The index of the task, from zero.
+ *
+ * @param pxStats The structure to be populated.
+ *
+ * @return pdPASS if the structure was populated, pdFAIL if uxIndex is not lower
+ * than the number of tasks in the system.
+ */
+BaseType_t xTaskGetStackStatsByIndex( UBaseType_t uxIndex, TaskStackStats_t * const pxStats ) PRIVILEGED_FUNCTION;
+
 /* When using trace macros it is sometimes necessary to include task.h before
 FreeRTOS.h.  When this is done TaskHookFunction_t will not yet have been defined,
 so the following two prototypes will cause a compilation error.  This can be
@@ -1527,6 +1619,62 @@ constant. */
  */
 BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter ) PRIVILEGED_FUNCTION;
 
+/**
+ * task.h
+ * <pre>void vTaskSetFPUFree( TaskHandle_t xTask, BaseType_t xFPUFree );</pre>
+ *
+ * configUSE_TASK_FPU_CONTROL must be defined as 1 for this function to be
+ * available.
+ *
+ * Marks the task xTask as FPU-free, i.e. declares that the task never
+ * executes a floating point instruction.  Passing xTask as NULL marks the
+ * calling task.
+ *
+ * The kernel does not change the floating point context of an FPU-free task.
+ * As the task never uses the FPU, its context switches neither save nor
+ * restore the floating point registers anyway, and configASSERT() fails when
+ * the task is switched out with a floating point context - the task (or code
+ * it calls, e.g. a library function or a compiler generated copy) used the FPU
+ * and must not be marked as FPU-free.
+ */
+void vTaskSetFPUFree( TaskHandle_t xTask, BaseType_t xFPUFree ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * <pre>void vTaskDropFPUContext( void );</pre>
+ *
+ * configUSE_TASK_FPU_CONTROL must be defined as 1 for this function to be
+ * available.
+ *
+ * Drops the floating point context of the calling task, so the following
+ * context switches do not save or restore the floating point registers until
+ * the task executes the next floating point instruction.
+ *
+ * WARNING: the contents of all floating point registers are lost.  s16-s31
+ * are callee-saved under the ARM procedure call standard, so any function up
+ * the call stack may keep values in them that it expects to be preserved
+ * across the call - neither the caller nor the compiler can tell.  Therefore
+ * this function must only be called directly from the entry function of the
+ * task, at the top of its loop, and that function must not keep floating point
+ * values in local variables - all floating point computations have to be done
+ * in (not inlined) functions it calls, which restore s16-s31 before they
+ * return.
+ */
+void vTaskDropFPUContext( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * <pre>uint32_t ulTaskGetFPUSwitchCount( TaskHandle_t xTask );</pre>
+ *
+ * configUSE_TASK_FPU_CONTROL must be defined as 1 for this function to be
+ * available.
+ *
+ * Returns the number of times the task xTask was switched out with its
+ * floating point context.  Passing xTask as NULL returns the value of the
+ * calling task.
+ */
+uint32_t ulTaskGetFPUSwitchCount( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * xTaskGetIdleTaskHandle() is only available if
  * INCLUDE_xTaskGetIdleTaskHandle is set to 1 in FreeRTOSConfig.h.
@@ -1633,7 +1781,32 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 	}
 	</pre>
  */
-UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for this function to be
+ * available.
+ *
+ * Populates a TaskRunTimeStats_t structure for each task in the system: the
+ * time spent running, the number of times the task was switched in and the
+ * histogram of latencies between the task being made ready (created,
+ * unblocked or resumed) and being switched in.  Unlike uxTaskGetSystemState(),
+ * it does not require configUSE_TRACE_FACILITY and does not inspect the task
+ * stacks, so it is cheap enough to be called periodically in production code.
+ *
+ * @param pxStatsArray An array of TaskRunTimeStats_t structures, one for each
+ * task.  The number of tasks can be obtained with uxTaskGetNumberOfTasks().
+ *
+ * @param uxArraySize The size of the array.  If it is smaller than the number
+ * of tasks in the system, nothing is written to the array and zero is
+ * returned.
+ *
+ * @param pulTotalRunTime Set to the current value of the run time counter (the
+ * total run time since the target booted).  Can be NULL.
+ *
+ * @return The number of TaskRunTimeStats_t structures populated.
+ */
+UBaseType_t uxTaskGetRunTimeStats( TaskRunTimeStats_t * const pxStatsArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 
 /**
  * task. h
@@ -1738,7 +1911,7 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
 
 /**
 * task. h
-* <PRE>TickType_t xTaskGetIdleRunTimeCounter( void );</PRE>
+* <PRE>configRUN_TIME_COUNTER_TYPE xTaskGetIdleRunTimeCounter( void );</PRE>
 *
 * configGENERATE_RUN_TIME_STATS and configUSE_STATS_FORMATTING_FUNCTIONS
 * must both be defined as 1 for this function to be available.  The application
@@ -1764,7 +1937,7 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
 * \defgroup xTaskGetIdleRunTimeCounter xTaskGetIdleRunTimeCounter
 * \ingroup TaskUtils
 */
-TickType_t xTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
+configRUN_TIME_COUNTER_TYPE xTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 
 /**
  * task. h
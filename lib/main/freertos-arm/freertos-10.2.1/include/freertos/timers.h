@@ -413,7 +413,9 @@ void vTimerSetTimerID( TimerHandle_t xTimer, void *pvNewID ) PRIVILEGED_FUNCTION
  *
  * A timer will be dormant if:
  *     1) It has been created but not started, or
- *     2) It is an expired one-shot timer that has not been restarted.
+ *     2) It is an expired one-shot timer that has not been restarted, or
+ *     3) configUSE_TIMER_LIST_HEAP is set to 1 and the timer did not fit into
+ *        the heap (configTIMER_HEAP_LENGTH) when it was started.
  *
  * Timers are created in the dormant state.  The xTimerStart(), xTimerReset(),
  * xTimerStartFromISR(), xTimerResetFromISR(), xTimerChangePeriod() and
@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include timing_wheel.h"
+#endif
+
+#include "list.h"
+
+/*
+ * Hashed timing wheel built on top of the kernel lists.  It stores list items
+ * ordered by their xItemValue, which holds an absolute tick count (e.g. wake
+ * time of a task), and can be used in place of a list sorted with vListInsert():
+ * - items are stored in the bucket selected by the lower bits of their tick
+ *   count.  Every bucket is kept sorted, but items are usually inserted in the
+ *   order of their tick count (e.g. tasks blocking with the same timeout), so
+ *   insertion appends the item in constant time in the common case,
+ * - an occupancy bitmap marks the non-empty buckets, so the earliest item is
+ *   found by visiting at most the heads of the occupied buckets, regardless of
+ *   the number of items in the wheel,
+ * - expired items are collected by visiting only the buckets of the ticks that
+ *   have passed, so expiry takes amortised constant time as long as
+ *   configTIMING_WHEEL_SIZE is not much smaller than the number of items,
+ * - items are removed with the regular uxListRemove(), so code that does not
+ *   care about the ordering (e.g. unblocking a task on an event) is unchanged.
+ *   The occupancy bit of a bucket emptied this way is cleared by the next
+ *   search that visits it.
+ *
+ * Like the sorted lists it replaces, a single wheel assumes that the tick count
+ * does not overflow between the time of the insertion and the expiry.  Items
+ * whose tick count has overflowed must be inserted into a second wheel, which
+ * is swapped with the first one when the tick count wraps around.
+ */
+
+#if( ( configTIMING_WHEEL_SIZE == 0 ) || ( ( configTIMING_WHEEL_SIZE & ( configTIMING_WHEEL_SIZE - 1 ) ) != 0 ) )
+	#error configTIMING_WHEEL_SIZE must be a power of two.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define wheelBITS_PER_WORD	( 32U )
+#define wheelWORD_COUNT		( ( configTIMING_WHEEL_SIZE + 31 ) / 32 )
+
+typedef struct xTIMING_WHEEL
+{
+	List_t xBuckets[ configTIMING_WHEEL_SIZE ];	/*< Bucket n holds items whose tick count modulo configTIMING_WHEEL_SIZE equals n, sorted by the tick count. */
+	uint32_t ulOccupied[ wheelWORD_COUNT ];		/*< Bit ( 31 - n ) of word w is set if bucket ( w * 32 + n ) may be non-empty. */
+} TimingWheel_t;
+
+/*
+ * Must be called before a timing wheel is used.  Initialises all the buckets
+ * of the wheel.
+ */
+void vTimingWheelInitialise( TimingWheel_t * const pxWheel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Inserts the item into the bucket selected by its item value.  The item value
+ * must be set before the call.  Takes constant time if the item value is not
+ * lower than the value of the last item in the bucket, otherwise the bucket is
+ * walked to find the position of the item.
+ */
+void vTimingWheelInsert( TimingWheel_t * const pxWheel, ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if there are no items in the wheel, otherwise pdFALSE.
+ */
+BaseType_t xTimingWheelIsEmpty( TimingWheel_t * const pxWheel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if pxList is one of the buckets of the wheel, otherwise
+ * pdFALSE.  Used to check whether an item (through its container) is stored in
+ * the wheel.
+ */
+BaseType_t xTimingWheelContainsList( const TimingWheel_t * const pxWheel, const List_t * const pxList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the item with the lowest item value or NULL if the wheel is empty.
+ * xFrom must not be greater than the item value of any item in the wheel.  The
+ * occupied buckets are visited in the order of ticks starting at xFrom and only
+ * their heads are checked, so the search ends at the first bucket whose head
+ * expires less than configTIMING_WHEEL_SIZE ticks after xFrom.  Otherwise the
+ * head with the lowest item value is returned.
+ */
+ListItem_t * pxTimingWheelGetEarliest( TimingWheel_t * const pxWheel, TickType_t xFrom ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves all the items with item value lower than or equal to xNow into
+ * pxExpiredList, sorted in the item value order.  Only the buckets of ticks
+ * from xFrom to xNow are visited, so xFrom must not be greater than the item
+ * value of any item in the wheel.
+ */
+void vTimingWheelCollectExpired( TimingWheel_t * const pxWheel, TickType_t xFrom, TickType_t xNow, List_t * const pxExpiredList ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMING_WHEEL_H */
@@ -0,0 +1,299 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include trace_recorder.h"
+#endif
+
+/*
+ * Trace recorder.
+ *
+ * The recorder implements the kernel trace macros and stores the traced events
+ * (context switches, tasks becoming ready, blocking, queue and semaphore
+ * operations, priority inheritance and task notifications) in a ring of fixed
+ * size records in RAM.  When the ring is full, the oldest records are
+ * overwritten, so it always holds the most recent history.  Every record is
+ * timestamped with ullTraceRecorderGetTimestamp(), which has to be provided by
+ * the application (or the platform).  Names of the tasks and of the queues
+ * added to the queue registry are kept in a separate table, so they are known
+ * even when the records of their creation were overwritten.
+ *
+ * All recorder data is held in a single, self-describing variable
+ * (xTraceRecorder), which can be dumped by a debugger or by the application
+ * (see pvTraceRecorderGetData()) and converted on the host to the
+ * Chrome/Perfetto trace format with tools/trace-converter.py.
+ *
+ * The recorder is enabled by setting configUSE_TRACE_RECORDER to 1 in
+ * FreeRTOSConfig.h, in which case this file is included by FreeRTOS.h and the
+ * trace macros defined below replace the ones defined by the application.
+ * Events are recorded from tasks and from interrupts that are allowed to call
+ * FreeRTOS API functions.
+ */
+
+#if( ( configTRACE_RECORDER_BUFFER_LENGTH & ( configTRACE_RECORDER_BUFFER_LENGTH - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_BUFFER_LENGTH must be a power of two.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Value of ulMagic in the recorder header ("FRTR" in little endian). */
+#define traceRECORDER_MAGIC		0x52545246UL
+
+/* Version of the recorder data layout. */
+#define traceRECORDER_VERSION	1U
+
+/* Flags stored in the ucFlags member of the record. */
+#define traceFLAG_FROM_ISR		0x01U	/*< The event was recorded by the FromISR variant of the API function. */
+#define traceFLAG_FAILED		0x02U	/*< The operation failed (e.g. queue was full or empty). */
+#define traceFLAG_READY			0x04U	/*< The task switched out is still ready to run (it was preempted or yielded). */
+
+/*
+ * Events stored in the records.  The meaning of the object and parameter
+ * stored with each event is given in the comments.
+ */
+typedef enum
+{
+	eTraceNone = 0,					/* Unused record. */
+	eTraceTaskSwitchedIn,			/* Task, priority. */
+	eTraceTaskSwitchedOut,			/* Task, priority. */
+	eTraceTaskReady,				/* Task, priority. */
+	eTraceTaskCreate,				/* Task, priority. */
+	eTraceTaskDelete,				/* Task, 0. */
+	eTraceTaskDelay,				/* Task, number of ticks to delay. */
+	eTraceTaskDelayUntil,			/* Task, tick count to wake up at. */
+	eTraceTaskPrioritySet,			/* Task, new priority. */
+	eTraceTaskPriorityInherit,		/* Mutex holder, inherited priority. */
+	eTraceTaskPriorityDisinherit,	/* Mutex holder, priority restored. */
+	eTraceTaskSuspend,				/* Task, 0. */
+	eTraceTaskResume,				/* Task, 0. */
+	eTraceTaskNotify,				/* Notified task, notification value. */
+	eTraceTaskNotifyBlock,			/* Waiting task, timeout in ticks. */
+	eTraceTaskNotifyReceive,		/* Waiting task, notification value. */
+	eTraceQueueCreate,				/* Queue, length (ucFlags holds the queue type). */
+	eTraceQueueDelete,				/* Queue, 0. */
+	eTraceQueueSend,				/* Queue, number of items before the operation. */
+	eTraceQueueReceive,				/* Queue, number of items before the operation. */
+	eTraceQueuePeek,				/* Queue, number of items before the operation. */
+	eTraceQueueBlockSend,			/* Queue, timeout in ticks. */
+	eTraceQueueBlockReceive,		/* Queue, timeout in ticks. */
+	eTraceUser						/* Channel, value given to vTraceRecorderUserEvent(). */
+} eTraceEvent;
+
+/*
+ * Single record in the ring.  Timestamps are 48 bits wide and counted from the
+ * first record written since the start or vTraceRecorderClear(), so they wrap
+ * only after 2^48 timestamp units of recording (~78 hours with nanosecond
+ * timestamps).  The host tools extend them across the wraps, assuming that
+ * consecutive records are less than one wrap period apart.  Objects are
+ * identified by the lower 32 bits of their handle.
+ */
+typedef struct xTRACE_RECORD
+{
+	uint32_t ulTimestampLow;		/*< Lower 32 bits of the timestamp. */
+	uint16_t usTimestampHigh;		/*< Bits 32-47 of the timestamp. */
+	uint8_t ucEvent;				/*< One of eTraceEvent values. */
+	uint8_t ucFlags;				/*< Combination of traceFLAG_* values, or the queue type for eTraceQueueCreate. */
+	uint32_t ulObject;				/*< The task, queue or user channel the event refers to. */
+	uint32_t ulParam;				/*< Event specific parameter. */
+} TraceRecord_t;
+
+/*
+ * Entry of the object name table.
+ */
+typedef struct xTRACE_OBJECT
+{
+	uint32_t ulObject;					/*< The object, 0 for unused entries. */
+	char pcName[ configMAX_TASK_NAME_LEN ];	/*< The name of the object, not terminated if it fills the whole array. */
+} TraceObject_t;
+
+/*
+ * Header at the beginning of the recorder data, which describes the layout of
+ * the rest of the data for the host tools.
+ */
+typedef struct xTRACE_RECORDER_HEADER
+{
+	uint32_t ulMagic;					/*< traceRECORDER_MAGIC. */
+	uint16_t usVersion;					/*< traceRECORDER_VERSION. */
+	uint16_t usHeaderSize;				/*< sizeof( TraceRecorderHeader_t ). */
+	uint16_t usObjectSize;				/*< sizeof( TraceObject_t ). */
+	uint16_t usRecordSize;				/*< sizeof( TraceRecord_t ). */
+	uint32_t ulObjectCount;				/*< The number of entries in the object name table. */
+	uint32_t ulRecordCount;				/*< The number of records in the ring. */
+	uint32_t ulHead;					/*< The number of records written so far (modulo 2^32). */
+	uint64_t ullTimestampFrequency;		/*< The number of timestamp units per second. */
+	uint32_t ulEnabled;					/*< Non-zero if the events are recorded. */
+	uint32_t ulNextObject;				/*< The object table entry to be reused when the table is full. */
+} TraceRecorderHeader_t;
+
+/*
+ * The recorder data: header, object name table and the ring of records, in
+ * this order and without padding in between.
+ */
+typedef struct xTRACE_RECORDER
+{
+	TraceRecorderHeader_t xHeader;
+	TraceObject_t xObjects[ configTRACE_RECORDER_MAX_OBJECTS ];
+	TraceRecord_t xRecords[ configTRACE_RECORDER_BUFFER_LENGTH ];
+} TraceRecorder_t;
+
+extern TraceRecorder_t xTraceRecorder;
+
+/*
+ * Returns the current timestamp.  Must be provided by the application (or the
+ * platform), must be monotonic and callable from tasks and interrupts with
+ * interrupts masked.
+ */
+uint64_t ullTraceRecorderGetTimestamp( void );
+
+/*
+ * Returns the number of timestamp units per second.  Must be provided by the
+ * application (or the platform).
+ */
+uint64_t ullTraceRecorderGetTimestampFrequency( void );
+
+/*
+ * vTraceRecorderStart() resumes and vTraceRecorderStop() suspends recording of
+ * the events.  The recorder is started when the program starts.  It should be
+ * stopped before its data is read, to get a consistent snapshot.  Both can
+ * be called from tasks and ISRs.
+ */
+void vTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Discards all records.  Object names are kept.
+ */
+void vTraceRecorderClear( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the recorder data, which can be written to a file or sent to the
+ * host for conversion.
+ *
+ * @param pxSize Set to the size of the data in bytes.
+ */
+const void *pvTraceRecorderGetData( size_t *pxSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets the name of the object shown by the host tools.  Names of the tasks
+ * and of the queues added to the queue registry are set automatically.  Can
+ * also be used to name the channels of the user events.
+ *
+ * @param pvObject The object (e.g. a handle), must not be NULL.
+ *
+ * @param pcName The name of the object.  It is copied to the recorder and
+ * truncated to configMAX_TASK_NAME_LEN characters.
+ */
+void vTraceRecorderSetObjectName( const void *pvObject, const char *pcName ) PRIVILEGED_FUNCTION;
+
+/*
+ * Records an application defined event.  Can be called from tasks and ISRs.
+ *
+ * @param pvChannel Any address identifying the source of the event, which
+ * can be named with vTraceRecorderSetObjectName().
+ *
+ * @param ulValue The value stored with the event.
+ */
+void vTraceRecorderUserEvent( const void *pvChannel, uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Records a kernel event.  Used by the trace macros below, not intended to be
+ * called directly by the application.
+ */
+void vTraceRecorderWrite( uint8_t ucEvent, uint8_t ucFlags, const void *pvObject, uint32_t ulParam ) PRIVILEGED_FUNCTION;
+
+/*
+ * Trace macros.  They are expanded inside tasks.c and queue.c, so they can
+ * access the kernel data structures and the local variables of the traced
+ * functions.
+ */
+#define traceRECORD( eEvent, ucFlags, pvObject, xParam ) vTraceRecorderWrite( ( uint8_t ) ( eEvent ), ( uint8_t ) ( ucFlags ), ( pvObject ), ( uint32_t ) ( xParam ) )
+
+#define traceTASK_SWITCHED_IN() traceRECORD( eTraceTaskSwitchedIn, 0U, pxCurrentTCB, pxCurrentTCB->uxPriority )
+
+#define traceTASK_SWITCHED_OUT()																			\
+	traceRECORD( eTraceTaskSwitchedOut,																		\
+				 listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xStateListItem ) ) ? traceFLAG_READY : 0U, \
+				 pxCurrentTCB,																				\
+				 pxCurrentTCB->uxPriority )
+
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB ) traceRECORD( eTraceTaskReady, 0U, ( pxTCB ), ( pxTCB )->uxPriority )
+
+#define traceTASK_CREATE( pxNewTCB )													\
+	do {																				\
+		vTraceRecorderSetObjectName( ( pxNewTCB ), ( pxNewTCB )->pcTaskName );			\
+		traceRECORD( eTraceTaskCreate, 0U, ( pxNewTCB ), ( pxNewTCB )->uxPriority );	\
+	} while( 0 )
+
+#define traceTASK_DELETE( pxTaskToDelete ) traceRECORD( eTraceTaskDelete, 0U, ( pxTaskToDelete ), 0U )
+#define traceTASK_DELAY() traceRECORD( eTraceTaskDelay, 0U, pxCurrentTCB, xTicksToDelay )
+#define traceTASK_DELAY_UNTIL( xTimeToWake ) traceRECORD( eTraceTaskDelayUntil, 0U, pxCurrentTCB, ( xTimeToWake ) )
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority ) traceRECORD( eTraceTaskPrioritySet, 0U, ( pxTask ), ( uxNewPriority ) )
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority ) traceRECORD( eTraceTaskPriorityInherit, 0U, ( pxTCBOfMutexHolder ), ( uxInheritedPriority ) )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) traceRECORD( eTraceTaskPriorityDisinherit, 0U, ( pxTCBOfMutexHolder ), ( uxOriginalPriority ) )
+#define traceTASK_SUSPEND( pxTaskToSuspend ) traceRECORD( eTraceTaskSuspend, 0U, ( pxTaskToSuspend ), 0U )
+#define traceTASK_RESUME( pxTaskToResume ) traceRECORD( eTraceTaskResume, 0U, ( pxTaskToResume ), 0U )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume ) traceRECORD( eTraceTaskResume, traceFLAG_FROM_ISR, ( pxTaskToResume ), 0U )
+
+#define traceTASK_NOTIFY() traceRECORD( eTraceTaskNotify, 0U, pxTCB, pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_FROM_ISR() traceRECORD( eTraceTaskNotify, traceFLAG_FROM_ISR, pxTCB, pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR() traceRECORD( eTraceTaskNotify, traceFLAG_FROM_ISR, pxTCB, pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_TAKE_BLOCK() traceRECORD( eTraceTaskNotifyBlock, 0U, pxCurrentTCB, xTicksToWait )
+#define traceTASK_NOTIFY_WAIT_BLOCK() traceRECORD( eTraceTaskNotifyBlock, 0U, pxCurrentTCB, xTicksToWait )
+#define traceTASK_NOTIFY_TAKE() traceRECORD( eTraceTaskNotifyReceive, 0U, pxCurrentTCB, pxCurrentTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_WAIT() traceRECORD( eTraceTaskNotifyReceive, 0U, pxCurrentTCB, pxCurrentTCB->ulNotifiedValue )
+
+#define traceQUEUE_CREATE( pxNewQueue ) traceRECORD( eTraceQueueCreate, ucQueueType, ( pxNewQueue ), ( pxNewQueue )->uxLength )
+#define traceQUEUE_DELETE( pxQueue ) traceRECORD( eTraceQueueDelete, 0U, ( pxQueue ), 0U )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName ) vTraceRecorderSetObjectName( ( xQueue ), ( pcQueueName ) )
+
+#define traceQUEUE_SEND( pxQueue ) traceRECORD( eTraceQueueSend, 0U, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FAILED( pxQueue ) traceRECORD( eTraceQueueSend, traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue ) traceRECORD( eTraceQueueSend, traceFLAG_FROM_ISR, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue ) traceRECORD( eTraceQueueSend, traceFLAG_FROM_ISR | traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE( pxQueue ) traceRECORD( eTraceQueueReceive, 0U, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue ) traceRECORD( eTraceQueueReceive, traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue ) traceRECORD( eTraceQueueReceive, traceFLAG_FROM_ISR, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue ) traceRECORD( eTraceQueueReceive, traceFLAG_FROM_ISR | traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK( pxQueue ) traceRECORD( eTraceQueuePeek, 0U, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK_FAILED( pxQueue ) traceRECORD( eTraceQueuePeek, traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK_FROM_ISR( pxQueue ) traceRECORD( eTraceQueuePeek, traceFLAG_FROM_ISR, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue ) traceRECORD( eTraceQueuePeek, traceFLAG_FROM_ISR | traceFLAG_FAILED, ( pxQueue ), ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue ) traceRECORD( eTraceQueueBlockSend, 0U, ( pxQueue ), xTicksToWait )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue ) traceRECORD( eTraceQueueBlockReceive, 0U, ( pxQueue ), xTicksToWait )
+#define traceBLOCKING_ON_QUEUE_PEEK( pxQueue ) traceRECORD( eTraceQueueBlockReceive, 0U, ( pxQueue ), xTicksToWait )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
@@ -234,6 +234,37 @@ portFORCE_INLINE static void vPortSetBASEPRI( uint32_t ulNewMaskValue )
 /*-----------------------------------------------------------*/
 
 #define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+/*-----------------------------------------------------------*/
+
+/* Floating point context control, used when configUSE_TASK_FPU_CONTROL is set
+to 1. */
+portFORCE_INLINE static void vPortDropFPUContext( void )
+{
+uint32_t ulControl;
+
+	/* Clearing CONTROL.FPCA marks the floating point registers as not used by
+	the running task, so they are neither stacked on exception entry nor saved
+	by the next context switch.  The bit is set again by the next floating
+	point instruction.  Must only be called from thread mode, when the floating
+	point registers hold no values that are still needed.  As s16-s31 are
+	callee-saved, any caller up the stack may keep values in them, so this is
+	only safe in the outermost frame of a task - see vTaskDropFPUContext().
+	Not yet verified on hardware. */
+	__asm volatile
+	(
+		"	mrs %0, control											\n" \
+		"	bic %0, %0, #4											\n" \
+		"	msr control, %0											\n" \
+		"	isb														\n" \
+		:"=r" (ulControl) :: "memory"
+	);
+}
+
+#define portDROP_FPU_CONTEXT()	vPortDropFPUContext()
+
+/* The PendSV handler saves the EXC_RETURN value above r4-r11, bit 4 of it is
+clear if the task was switched out with its floating point context. */
+#define portTASK_FPU_CONTEXT_SAVED( pxTopOfStack ) ( ( ( pxTopOfStack )[ 8 ] & 0x10UL ) == 0UL )
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,459 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Linux host
+ * simulator port.
+ *
+ * Every task is backed by a POSIX thread, but only the thread of the task
+ * selected by the scheduler is allowed to run. All other task threads are
+ * parked on their own wake event. The tick interrupt is emulated with SIGALRM
+ * generated by an interval timer, and disabling interrupts means blocking
+ * SIGALRM in the calling thread. As a result only the thread of the running
+ * task can ever receive the tick.
+ *
+ * Limitations:
+ * - task stacks are not used for execution (threads run on stacks allocated
+ *   by pthreads), only the top of each stack holds the thread descriptor,
+ * - a task preempted by the tick while holding a host library lock (e.g. the
+ *   stdio or malloc lock) blocks other tasks using the same lock until it is
+ *   scheduled again.
+ *----------------------------------------------------------*/
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#if( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) && ( configUSE_MUTEXES == 0 )
+	#error The Linux port requires INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES to be set to 1.
+#endif
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+	#error The Linux port does not implement tickless idle. Set configUSE_TICKLESS_IDLE to 2 and provide vPortSuppressTicksAndSleep().
+#endif
+
+/* Tick period expressed in microseconds. */
+#define portTICK_PERIOD_US					( 1000000UL / configTICK_RATE_HZ )
+
+/*-----------------------------------------------------------*/
+
+/* Binary event used to park and wake host threads. */
+typedef struct EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	BaseType_t xSignaled;
+} Event_t;
+
+/* Host thread descriptor, stored at the top of the task stack. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xDying;
+	Event_t xWakeEvent;
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/* Each task maintains its own interrupt status in the critical nesting
+variable. The value is saved and restored by every thread switch. */
+static volatile UBaseType_t uxCriticalNesting = 0;
+
+/* Signaled by vPortEndScheduler() to let xPortStartScheduler() return. */
+static Event_t xSchedulerEndEvent = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, pdFALSE };
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Event primitives used to park and wake host threads.
+ */
+static void prvEventInit( Event_t *pxEvent );
+static void prvEventDestroy( Event_t *pxEvent );
+static void prvEventSignal( Event_t *pxEvent );
+static void prvEventWait( Event_t *pxEvent );
+
+/*
+ * Returns the tick signal as a single element signal set.
+ */
+static void prvGetTickSignalSet( sigset_t *pxSignalSet );
+
+/*
+ * Returns the host thread descriptor of the given task.
+ */
+static Thread_t *prvGetThreadFromTask( TaskHandle_t xTask );
+
+/*
+ * Parks the calling thread until it is selected to run again. Terminates the
+ * calling thread if its task was deleted in the meantime.
+ */
+static void prvSuspendSelf( Thread_t *pxThread );
+
+/*
+ * Wakes the thread of the task selected by the scheduler and parks the calling
+ * thread.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Entry point of all task threads.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Tick interrupt handler.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_init( &( pxEvent->xMutex ), NULL );
+	( void ) pthread_cond_init( &( pxEvent->xCond ), NULL );
+	pxEvent->xSignaled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDestroy( Event_t *pxEvent )
+{
+	( void ) pthread_cond_destroy( &( pxEvent->xCond ) );
+	( void ) pthread_mutex_destroy( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+	pxEvent->xSignaled = pdTRUE;
+	( void ) pthread_cond_signal( &( pxEvent->xCond ) );
+	( void ) pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+
+	while( pxEvent->xSignaled == pdFALSE )
+	{
+		( void ) pthread_cond_wait( &( pxEvent->xCond ), &( pxEvent->xMutex ) );
+	}
+
+	pxEvent->xSignaled = pdFALSE;
+	( void ) pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetTickSignalSet( sigset_t *pxSignalSet )
+{
+	( void ) sigemptyset( pxSignalSet );
+	( void ) sigaddset( pxSignalSet, portTICK_SIGNAL );
+}
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( TaskHandle_t xTask )
+{
+	/* The first member of the TCB is the top of stack pointer, which in this
+	port points to the thread descriptor. */
+	return ( Thread_t * ) *( ( StackType_t ** ) xTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	prvEventWait( &( pxThread->xWakeEvent ) );
+
+	if( pxThread->xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		/* The critical nesting belongs to the task, so it has to survive the
+		time the thread is parked. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvEventSignal( &( pxThreadToResume->xWakeEvent ) );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* The task has deleted itself - it will never run again. */
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Wait until the scheduler selects this task for the first time. */
+	prvSuspendSelf( pxThread );
+
+	/* Tasks start with interrupts enabled. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* A task function should never return. On the host it is safe to just
+	delete the task, so the remaining ones can continue. */
+	#if( INCLUDE_vTaskDelete == 1 )
+	{
+		vTaskDelete( NULL );
+	}
+	#else
+	{
+		abort();
+	}
+	#endif
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	( void ) iSignal;
+
+	/* The tick signal is blocked for the duration of the handler, which is
+	equivalent to running with interrupts disabled. */
+	uxCriticalNesting++;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xTickSignalSet;
+sigset_t xOriginalSignalSet;
+int iResult;
+
+	/* The thread descriptor is placed at the top of the task stack. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &( pxThread->xWakeEvent ) );
+
+	/* New threads inherit the signal mask of the creator, so block the tick
+	signal for the time of creation. It will be unblocked by the thread once
+	its task is selected to run. */
+	prvGetTickSignalSet( &xTickSignalSet );
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignalSet, &xOriginalSignalSet );
+	iResult = pthread_create( &( pxThread->xThread ), NULL, prvThreadEntry, pxThread );
+	( void ) pthread_sigmask( SIG_SETMASK, &xOriginalSignalSet, NULL );
+
+	if( iResult != 0 )
+	{
+		abort();
+	}
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+sigset_t xTickSignalSet;
+struct sigaction xTickAction = { 0 };
+struct itimerval xTimer = { 0 };
+
+	/* The tick is never handled by the thread which started the scheduler. */
+	prvGetTickSignalSet( &xTickSignalSet );
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignalSet, NULL );
+
+	/* Interrupted system calls are restarted, so the tick does not leak into
+	the host library calls made by tasks. */
+	xTickAction.sa_handler = prvTickSignalHandler;
+	xTickAction.sa_flags = SA_RESTART;
+	( void ) sigfillset( &( xTickAction.sa_mask ) );
+	( void ) sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	xTimer.it_interval.tv_usec = portTICK_PERIOD_US;
+	xTimer.it_value.tv_usec = portTICK_PERIOD_US;
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	/* Start the first task. */
+	uxCriticalNesting = 0;
+	prvEventSignal( &( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->xWakeEvent ) );
+
+	/* Wait until vTaskEndScheduler() is called. */
+	prvEventWait( &xSchedulerEndEvent );
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer = { 0 };
+struct sigaction xTickAction = { 0 };
+
+	/* Stop the tick and ignore the one which may be pending. */
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+	xTickAction.sa_handler = SIG_IGN;
+	( void ) sigemptyset( &( xTickAction.sa_mask ) );
+	( void ) sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	/* Let xPortStartScheduler() return and park the calling task forever. */
+	prvEventSignal( &xSchedulerEndEvent );
+	prvEventWait( &( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->xWakeEvent ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	vPortEnterCritical();
+	{
+		pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+sigset_t xTickSignalSet;
+
+	prvGetTickSignalSet( &xTickSignalSet );
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignalSet, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+sigset_t xTickSignalSet;
+
+	prvGetTickSignalSet( &xTickSignalSet );
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xTickSignalSet, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xTickSignalSet;
+sigset_t xOriginalSignalSet;
+
+	prvGetTickSignalSet( &xTickSignalSet );
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignalSet, &xOriginalSignalSet );
+
+	/* Return whether the tick was already masked before the call. */
+	return ( sigismember( &xOriginalSignalSet, portTICK_SIGNAL ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	uxCriticalNesting--;
+
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+	( void ) pxPendYield;
+
+	/* The thread will terminate itself on the next thread switch. */
+	prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete );
+
+	/* Wake the parked thread, so it can terminate itself. If the task has
+	deleted itself, then its thread is already gone and this is no-op. */
+	pxThread->xDying = pdTRUE;
+	prvEventSignal( &( pxThread->xWakeEvent ) );
+	( void ) pthread_join( pxThread->xThread, NULL );
+	prvEventDestroy( &( pxThread->xWakeEvent ) );
+}
+/*-----------------------------------------------------------*/
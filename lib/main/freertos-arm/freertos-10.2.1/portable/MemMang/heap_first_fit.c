@@ -0,0 +1,371 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * First fit heap with coalescing of adjacent free blocks.
+ *
+ * Free blocks are kept in a single list sorted by address.  An allocation
+ * takes the first free block that is large enough and splits off the part that
+ * is not needed, and a freed block is merged with the free blocks directly in
+ * front of and behind it, so the heap does not fragment into blocks smaller
+ * than the ones that were freed.  Both operations are linear in the number of
+ * free blocks.
+ *
+ * The heap can span several regions of memory that do not have to be
+ * contiguous (e.g. SRAM and CCM), see vPortDefineHeapRegions().  If no regions
+ * were defined before the first allocation, they are obtained from
+ * vApplicationGetHeapRegions().
+ *
+ * See heap_tlsf.c for an implementation with constant time operations.
+ */
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/* Every block starts with a header, so the memory returned to the application
+is correctly aligned if the header size is a multiple of the alignment. */
+#define heapHEADER_SIZE			( ( sizeof( BlockLink_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Blocks smaller than this are not split off when a larger block is taken. */
+#define heapMINIMUM_BLOCK_SIZE	( heapHEADER_SIZE * ( size_t ) 2 )
+
+/* The most significant bit of the block size marks blocks owned by the
+application. */
+#define heapBLOCK_ALLOCATED_BIT	( ( size_t ) 1 << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Header of every block.  The free list link is only used while the block is
+free. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxNextFreeBlock;	/*< The next free block in the list, NULL for the last one. */
+	size_t xBlockSize;						/*< The size of the block, including the header. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts the block into the free list at the position given by its address
+ * and merges it with the adjacent free blocks.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a region of memory to the heap.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The head of the list of free blocks. */
+PRIVILEGED_DATA static BlockLink_t xStart = { NULL, 0 };
+
+/* Statistics of the heap. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static BaseType_t xHeapInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlock;
+void *pvReturn = NULL;
+
+	/* Add the header and round up to the alignment, making sure the result
+	does not overflow into the allocated bit. */
+	if( ( xWantedSize > ( size_t ) 0 ) && ( xWantedSize < ( heapBLOCK_ALLOCATED_BIT - heapHEADER_SIZE - ( size_t ) portBYTE_ALIGNMENT ) ) )
+	{
+		xWantedSize += heapHEADER_SIZE;
+		xWantedSize = ( xWantedSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	}
+	else
+	{
+		xWantedSize = 0;
+	}
+
+	vTaskSuspendAll();
+	{
+		if( xHeapInitialised == pdFALSE )
+		{
+		const HeapRegion_t *pxHeapRegions = NULL;
+
+			vApplicationGetHeapRegions( &pxHeapRegions );
+			vPortDefineHeapRegions( pxHeapRegions );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize > ( size_t ) 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+		{
+			/* Take the first block that is large enough. */
+			pxPreviousBlock = &xStart;
+			pxBlock = xStart.pxNextFreeBlock;
+			while( ( pxBlock != NULL ) && ( pxBlock->xBlockSize < xWantedSize ) )
+			{
+				pxPreviousBlock = pxBlock;
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+
+			if( pxBlock != NULL )
+			{
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE );
+
+				if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+				{
+					/* Split off the unused end of the block.  It takes the place
+					of the block in the free list, which keeps the list sorted
+					and needs no merging, as its neighbours do not change. */
+					pxNewBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+					pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxNewBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+					pxPreviousBlock->pxNextFreeBlock = pxNewBlock;
+					pxBlock->xBlockSize = xWantedSize;
+				}
+				else
+				{
+					pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+				pxBlock->pxNextFreeBlock = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+BlockLink_t *pxBlock;
+
+	if( pv != NULL )
+	{
+		pxBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pv ) - heapHEADER_SIZE );
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+		configASSERT( pxBlock->pxNextFreeBlock == NULL );
+
+		if( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			pxBlock->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+
+			vTaskSuspendAll();
+			{
+				xFreeBytesRemaining += pxBlock->xBlockSize;
+				traceFREE( pv, pxBlock->xBlockSize );
+				prvInsertBlockIntoFreeList( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetUsableSize( void *pv )
+{
+const BlockLink_t *pxBlock = ( const BlockLink_t * ) ( ( ( uint8_t * ) pv ) - heapHEADER_SIZE );
+
+	configASSERT( pv );
+	configASSERT( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+
+	return ( pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BIT ) - heapHEADER_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxRegion;
+
+	/* Can only be called once, before the first allocation. */
+	configASSERT( xHeapInitialised == pdFALSE );
+	configASSERT( pxHeapRegions );
+
+	for( pxRegion = pxHeapRegions; pxRegion->xSizeInBytes > ( size_t ) 0; pxRegion++ )
+	{
+		prvAddRegion( pxRegion->pucStartAddress, pxRegion->xSizeInBytes );
+	}
+
+	/* Check something was actually added to the heap. */
+	configASSERT( xFreeBytesRemaining > ( size_t ) 0 );
+
+	xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+	xHeapInitialised = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+size_t xAddress = ( size_t ) pucStartAddress;
+size_t xEndAddress = xAddress + xSizeInBytes;
+BlockLink_t *pxBlock;
+
+	/* Use only the aligned part of the region. */
+	xAddress = ( xAddress + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	xEndAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	if( ( xEndAddress > xAddress ) && ( ( xEndAddress - xAddress ) >= heapMINIMUM_BLOCK_SIZE ) )
+	{
+		/* The region becomes a single free block. */
+		pxBlock = ( BlockLink_t * ) xAddress;
+		pxBlock->xBlockSize = xEndAddress - xAddress;
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 );
+
+		xFreeBytesRemaining += pxBlock->xBlockSize;
+		prvInsertBlockIntoFreeList( pxBlock );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert )
+{
+BlockLink_t *pxIterator, *pxNextBlock;
+
+	/* Find the last free block in front of the inserted one. */
+	for( pxIterator = &xStart; ( pxIterator->pxNextFreeBlock != NULL ) && ( pxIterator->pxNextFreeBlock < pxBlockToInsert ); pxIterator = pxIterator->pxNextFreeBlock )
+	{
+		/* Nothing to do here, just iterate to the right position. */
+	}
+
+	pxNextBlock = pxIterator->pxNextFreeBlock;
+
+	/* Merge with the block in front if they form a contiguous block of
+	memory. */
+	if( ( pxIterator != &xStart ) && ( ( ( ( uint8_t * ) pxIterator ) + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert ) )
+	{
+		pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+		pxBlockToInsert = pxIterator;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Merge with the block behind if they form a contiguous block of
+	memory. */
+	if( ( pxNextBlock != NULL ) && ( ( ( ( uint8_t * ) pxBlockToInsert ) + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxNextBlock ) )
+	{
+		pxBlockToInsert->xBlockSize += pxNextBlock->xBlockSize;
+		pxBlockToInsert->pxNextFreeBlock = pxNextBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		pxBlockToInsert->pxNextFreeBlock = pxNextBlock;
+	}
+
+	if( pxBlockToInsert != pxIterator )
+	{
+		pxIterator->pxNextFreeBlock = pxBlockToInsert;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
@@ -0,0 +1,638 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Two level segregated fit (TLSF) heap.
+ *
+ * Free blocks are kept in segregated lists indexed by a two level size class:
+ * the first level is the power of two of the block size and the second level
+ * divides that range linearly into tlsfSL_COUNT classes.  A bitmap of
+ * non-empty lists is kept for each level, so a suitable free block is found
+ * with two "find first set" operations and allocation as well as freeing take
+ * constant time, independent of the number of blocks in the heap.  A freed
+ * block is merged with its physical neighbours, which are reached through the
+ * size of the block and a pointer to the previous block kept in every header.
+ *
+ * The price for the bounded execution time is a slightly larger block header
+ * and rounding of the requested sizes up to the size class boundary, which
+ * wastes at most 1/tlsfSL_COUNT of each allocation.
+ *
+ * The heap can span several regions of memory that do not have to be
+ * contiguous (e.g. SRAM and CCM), see vPortDefineHeapRegions().  If no regions
+ * were defined before the first allocation, they are obtained from
+ * vApplicationGetHeapRegions().
+ */
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+#if( portBYTE_ALIGNMENT == 4 )
+	#define tlsfALIGNMENT_LOG2	2
+#elif( portBYTE_ALIGNMENT == 8 )
+	#define tlsfALIGNMENT_LOG2	3
+#elif( portBYTE_ALIGNMENT == 16 )
+	#define tlsfALIGNMENT_LOG2	4
+#elif( portBYTE_ALIGNMENT == 32 )
+	#define tlsfALIGNMENT_LOG2	5
+#else
+	#error portBYTE_ALIGNMENT not supported by heap_tlsf.c
+#endif
+
+/* Number of second level classes per power of two is 2^tlsfSL_LOG2. */
+#define tlsfSL_LOG2				4
+#define tlsfSL_COUNT			( 1U << tlsfSL_LOG2 )
+
+/* Sizes below 2^tlsfFL_SHIFT are mapped linearly into the first class, where
+each second level class is exactly portBYTE_ALIGNMENT bytes wide. */
+#define tlsfFL_SHIFT			( tlsfSL_LOG2 + tlsfALIGNMENT_LOG2 )
+
+/* Largest supported block is smaller than 2^(tlsfFL_MAX_LOG2 + 1). */
+#define tlsfFL_MAX_LOG2			30
+#define tlsfFL_COUNT			( tlsfFL_MAX_LOG2 - tlsfFL_SHIFT + 2 )
+#define tlsfMAX_BLOCK_SIZE		( ( ( size_t ) 1 << ( tlsfFL_MAX_LOG2 + 1 ) ) - ( size_t ) 1 )
+
+/* Bit 0 of the block size marks free blocks (sizes are multiples of the
+alignment, so the bit is never part of the size). */
+#define tlsfBLOCK_FREE_BIT		( ( size_t ) 1 )
+#define tlsfBLOCK_SIZE_MASK		( ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Only the physical links are part of the header of an allocated block, the
+free list links overlap the application data. */
+#define tlsfHEADER_SIZE			( ( offsetof( BlockHeader_t, pxNextFree ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+#define tlsfMINIMUM_BLOCK_SIZE	( ( sizeof( BlockHeader_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+typedef struct TLSF_BLOCK_HEADER
+{
+	struct TLSF_BLOCK_HEADER *pxPrevPhysBlock;	/*< The block directly in front of this one in memory, NULL for the first block of a region. */
+	size_t xBlockSize;							/*< The size of the block including the header, with tlsfBLOCK_FREE_BIT set for free blocks. */
+	struct TLSF_BLOCK_HEADER *pxNextFree;		/*< The next block in the same free list, only valid for free blocks. */
+	struct TLSF_BLOCK_HEADER *pxPrevFree;		/*< The previous block in the same free list, only valid for free blocks. */
+} BlockHeader_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the index of the most and least significant set bit of the value,
+ * which has to be non-zero.
+ */
+static UBaseType_t prvFindLastSet( size_t xValue );
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+
+/*
+ * Calculates the size class of the given block size.
+ */
+static void prvMapping( size_t xSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Finds a free block of at least the given size.  Returns NULL if there is no
+ * such block.
+ */
+static BlockHeader_t *prvFindSuitableBlock( size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add and remove the block to and from the free list of its size class.
+ */
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the block directly behind the given one in memory.
+ */
+static BlockHeader_t *prvNextPhysBlock( const BlockHeader_t *pxBlock );
+
+/*
+ * Adds a region of memory to the heap.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* Bitmap of first level classes with at least one non-empty second level
+class, and the bitmaps of non-empty second level classes. */
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmaps[ tlsfFL_COUNT ];
+
+/* Heads of the free lists of all size classes. */
+PRIVILEGED_DATA static BlockHeader_t *pxFreeLists[ tlsfFL_COUNT ][ tlsfSL_COUNT ];
+
+/* Statistics of the heap. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static BaseType_t xHeapInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockHeader_t *pxBlock, *pxNewBlock;
+void *pvReturn = NULL;
+
+	/* Add the header and round up to the alignment.  The block has to be able
+	to hold the free list links once it is freed again. */
+	if( ( xWantedSize > ( size_t ) 0 ) && ( xWantedSize <= ( tlsfMAX_BLOCK_SIZE - tlsfHEADER_SIZE - ( size_t ) portBYTE_ALIGNMENT ) ) )
+	{
+		xWantedSize += tlsfHEADER_SIZE;
+		xWantedSize = ( xWantedSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		if( xWantedSize < tlsfMINIMUM_BLOCK_SIZE )
+		{
+			xWantedSize = tlsfMINIMUM_BLOCK_SIZE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		xWantedSize = 0;
+	}
+
+	vTaskSuspendAll();
+	{
+		if( xHeapInitialised == pdFALSE )
+		{
+		const HeapRegion_t *pxHeapRegions = NULL;
+
+			vApplicationGetHeapRegions( &pxHeapRegions );
+			vPortDefineHeapRegions( pxHeapRegions );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize > ( size_t ) 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+		{
+			pxBlock = prvFindSuitableBlock( xWantedSize );
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxBlock );
+
+				if( ( ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) - xWantedSize ) >= tlsfMINIMUM_BLOCK_SIZE )
+				{
+					/* Split off the unused end of the block and return it to the
+					free lists.  Its physical neighbours are both in use, so no
+					merging is necessary. */
+					pxNewBlock = ( BlockHeader_t * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					pxNewBlock->xBlockSize = ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) - xWantedSize;
+					pxNewBlock->pxPrevPhysBlock = pxBlock;
+					prvNextPhysBlock( pxNewBlock )->pxPrevPhysBlock = pxNewBlock;
+					pxBlock->xBlockSize = xWantedSize;
+					prvInsertFreeBlock( pxNewBlock );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + tlsfHEADER_SIZE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+BlockHeader_t *pxBlock, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		pxBlock = ( BlockHeader_t * ) ( ( ( uint8_t * ) pv ) - tlsfHEADER_SIZE );
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & tlsfBLOCK_FREE_BIT ) == 0 );
+		configASSERT( ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) >= tlsfMINIMUM_BLOCK_SIZE );
+
+		if( ( pxBlock->xBlockSize & tlsfBLOCK_FREE_BIT ) == 0 )
+		{
+			vTaskSuspendAll();
+			{
+				xFreeBytesRemaining += pxBlock->xBlockSize;
+				traceFREE( pv, pxBlock->xBlockSize );
+
+				/* Merge with the block in front if it is free. */
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & tlsfBLOCK_FREE_BIT ) != 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize = ( pxNeighbour->xBlockSize & tlsfBLOCK_SIZE_MASK ) + pxBlock->xBlockSize;
+					pxBlock = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block behind if it is free.  The sentinel at
+				the end of the region is never free. */
+				pxNeighbour = prvNextPhysBlock( pxBlock );
+				if( ( pxNeighbour->xBlockSize & tlsfBLOCK_FREE_BIT ) != 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xBlockSize = ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) + ( pxNeighbour->xBlockSize & tlsfBLOCK_SIZE_MASK );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvNextPhysBlock( pxBlock )->pxPrevPhysBlock = pxBlock;
+				prvInsertFreeBlock( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetUsableSize( void *pv )
+{
+const BlockHeader_t *pxBlock = ( const BlockHeader_t * ) ( ( ( uint8_t * ) pv ) - tlsfHEADER_SIZE );
+
+	configASSERT( pv );
+	configASSERT( ( pxBlock->xBlockSize & tlsfBLOCK_FREE_BIT ) == 0 );
+
+	return pxBlock->xBlockSize - tlsfHEADER_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxRegion;
+
+	/* Can only be called once, before the first allocation. */
+	configASSERT( xHeapInitialised == pdFALSE );
+	configASSERT( pxHeapRegions );
+
+	for( pxRegion = pxHeapRegions; pxRegion->xSizeInBytes > ( size_t ) 0; pxRegion++ )
+	{
+		prvAddRegion( pxRegion->pucStartAddress, pxRegion->xSizeInBytes );
+	}
+
+	/* Check something was actually added to the heap. */
+	configASSERT( xFreeBytesRemaining > ( size_t ) 0 );
+
+	xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+	xHeapInitialised = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+size_t xAddress = ( size_t ) pucStartAddress;
+size_t xEndAddress = xAddress + xSizeInBytes;
+size_t xBlockSize;
+BlockHeader_t *pxBlock, *pxSentinel;
+
+	/* Use only the aligned part of the region. */
+	xAddress = ( xAddress + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	xEndAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	if( ( xEndAddress > xAddress ) && ( ( xEndAddress - xAddress ) >= ( tlsfMINIMUM_BLOCK_SIZE + tlsfHEADER_SIZE ) ) )
+	{
+		/* The region becomes a single free block followed by a sentinel block
+		of size zero, which is never free and stops merging at the end of the
+		region.  Regions larger than the largest block are truncated. */
+		xBlockSize = xEndAddress - xAddress - tlsfHEADER_SIZE;
+		if( xBlockSize > ( tlsfMAX_BLOCK_SIZE & tlsfBLOCK_SIZE_MASK ) )
+		{
+			xBlockSize = tlsfMAX_BLOCK_SIZE & tlsfBLOCK_SIZE_MASK;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxBlock = ( BlockHeader_t * ) xAddress;
+		pxBlock->pxPrevPhysBlock = NULL;
+		pxBlock->xBlockSize = xBlockSize;
+
+		pxSentinel = prvNextPhysBlock( pxBlock );
+		pxSentinel->pxPrevPhysBlock = pxBlock;
+		pxSentinel->xBlockSize = 0;
+
+		xFreeBytesRemaining += xBlockSize;
+		prvInsertFreeBlock( pxBlock );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( size_t xValue )
+{
+	#if defined( __GNUC__ )
+	{
+		return ( UBaseType_t ) ( ( sizeof( unsigned long ) * 8U ) - 1U - ( UBaseType_t ) __builtin_clzl( ( unsigned long ) xValue ) );
+	}
+	#else
+	{
+	UBaseType_t uxBit = 0;
+
+		while( ( xValue >>= 1 ) != ( size_t ) 0 )
+		{
+			uxBit++;
+		}
+
+		return uxBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+	#if defined( __GNUC__ )
+	{
+		return ( UBaseType_t ) __builtin_ctzl( ( unsigned long ) ulValue );
+	}
+	#else
+	{
+	UBaseType_t uxBit = 0;
+
+		while( ( ulValue & 1UL ) == 0UL )
+		{
+			ulValue >>= 1;
+			uxBit++;
+		}
+
+		return uxBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapping( size_t xSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+UBaseType_t uxLog2;
+
+	if( xSize < ( ( size_t ) 1 << tlsfFL_SHIFT ) )
+	{
+		*puxFirstLevel = 0;
+		*puxSecondLevel = ( UBaseType_t ) ( xSize >> tlsfALIGNMENT_LOG2 );
+	}
+	else
+	{
+		uxLog2 = prvFindLastSet( xSize );
+		*puxFirstLevel = uxLog2 - ( UBaseType_t ) tlsfFL_SHIFT + 1U;
+		*puxSecondLevel = ( UBaseType_t ) ( ( xSize >> ( uxLog2 - tlsfSL_LOG2 ) ) ^ tlsfSL_COUNT );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockHeader_t *prvFindSuitableBlock( size_t xSize )
+{
+uint32_t ulBitmap;
+size_t xRoundedSize = xSize;
+UBaseType_t uxFirstLevel, uxSecondLevel;
+BlockHeader_t *pxBlock;
+
+	/* Round the size up to the next class boundary, so every block in the
+	class found is large enough and the head of its list can be taken. */
+	if( xSize >= ( ( size_t ) 1 << tlsfFL_SHIFT ) )
+	{
+		xRoundedSize += ( ( size_t ) 1 << ( prvFindLastSet( xSize ) - tlsfSL_LOG2 ) ) - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMapping( xRoundedSize, &uxFirstLevel, &uxSecondLevel );
+	if( uxFirstLevel < ( UBaseType_t ) tlsfFL_COUNT )
+	{
+		/* Look in the same first level class first, for classes not smaller
+		than the requested one, then in the next non-empty first level. */
+		ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ] & ( ~0UL << uxSecondLevel );
+		if( ulBitmap == 0U )
+		{
+			ulBitmap = ulFirstLevelBitmap & ( ~0UL << ( uxFirstLevel + 1U ) );
+			if( ulBitmap != 0U )
+			{
+				uxFirstLevel = prvFindFirstSet( ulBitmap );
+				ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ];
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulBitmap != 0U )
+		{
+			return pxFreeLists[ uxFirstLevel ][ prvFindFirstSet( ulBitmap ) ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* No larger class has free blocks, but the head of the class of the
+	requested size may still be large enough.  This matters when the heap is
+	almost full and the only free block is in that class. */
+	prvMapping( xSize, &uxFirstLevel, &uxSecondLevel );
+	if( uxFirstLevel < ( UBaseType_t ) tlsfFL_COUNT )
+	{
+		pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+		if( ( pxBlock != NULL ) && ( ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) >= xSize ) )
+		{
+			return pxBlock;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	pxBlock->xBlockSize |= tlsfBLOCK_FREE_BIT;
+	prvMapping( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK, &uxFirstLevel, &uxSecondLevel );
+
+	pxBlock->pxPrevFree = NULL;
+	pxBlock->pxNextFree = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+	if( pxBlock->pxNextFree != NULL )
+	{
+		pxBlock->pxNextFree->pxPrevFree = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+	ulFirstLevelBitmap |= ( 1UL << uxFirstLevel );
+	ulSecondLevelBitmaps[ uxFirstLevel ] |= ( 1UL << uxSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapping( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK, &uxFirstLevel, &uxSecondLevel );
+
+	if( pxBlock->pxNextFree != NULL )
+	{
+		pxBlock->pxNextFree->pxPrevFree = pxBlock->pxPrevFree;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFree != NULL )
+	{
+		pxBlock->pxPrevFree->pxNextFree = pxBlock->pxNextFree;
+	}
+	else
+	{
+		/* The block was the head of the list, which may now be empty. */
+		pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFree;
+		if( pxBlock->pxNextFree == NULL )
+		{
+			ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( 1UL << uxSecondLevel );
+			if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0U )
+			{
+				ulFirstLevelBitmap &= ~( 1UL << uxFirstLevel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxBlock->xBlockSize &= tlsfBLOCK_SIZE_MASK;
+}
+/*-----------------------------------------------------------*/
+
+static BlockHeader_t *prvNextPhysBlock( const BlockHeader_t *pxBlock )
+{
+	return ( BlockHeader_t * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK ) );
+}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
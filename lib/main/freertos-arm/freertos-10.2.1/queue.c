@@ -51,6 +51,7 @@ correct privileged Vs unprivileged linkage and placement. */
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
+#define queueMAX_LOCK_COUNT				( ( int8_t ) 127 )
 
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
@@ -81,6 +82,18 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+#if ( configUSE_QUEUE_LOANS == 1 )
+	/* A loaned send slot is the next slot to be written, so while it is loaned
+	the queue is full for all other senders.  A loaned receive slot is the next
+	slot to be read, so while it is loaned the queue is empty for all other
+	receivers and nothing can be placed in front of it. */
+	#define prvLoanAllowsSend( pxQueue, xPosition ) ( ( ( pxQueue )->pcSendLoan == NULL ) && ( ( ( xPosition ) == queueSEND_TO_BACK ) || ( ( pxQueue )->pcReceiveLoan == NULL ) ) )
+	#define prvLoanAllowsReceive( pxQueue ) ( ( pxQueue )->pcReceiveLoan == NULL )
+#else
+	#define prvLoanAllowsSend( pxQueue, xPosition ) ( pdTRUE )
+	#define prvLoanAllowsReceive( pxQueue ) ( pdTRUE )
+#endif
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -128,6 +141,11 @@ typedef struct QueueDefinition 		/* The old naming convention is used to prevent
 		uint8_t ucQueueType;
 	#endif
 
+	#if ( configUSE_QUEUE_LOANS == 1 )
+		int8_t *pcSendLoan;			/*< Points to the slot acquired by xQueueAcquireSendSlot() and not yet committed, or NULL if there is none. */
+		int8_t *pcReceiveLoan;		/*< Points to the slot acquired by xQueueAcquireReceiveSlot() and not yet released, or NULL if there is none. */
+	#endif
+
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -174,18 +192,21 @@ typedef xQUEUE Queue_t;
 static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any data in a queue.
+ * Uses a critical section to determine if there is any data in a queue that
+ * can be received.
  *
- * @return pdTRUE if the queue contains no items, otherwise pdFALSE.
+ * @return pdTRUE if the queue contains no items or its next item is loaned,
+ * otherwise pdFALSE.
  */
 static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if an item can be placed in a queue at
+ * the given position.
  *
- * @return pdTRUE if there is no space, otherwise pdFALSE;
+ * @return pdTRUE if there is no space or the slot is loaned, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -198,6 +219,44 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies as many of the given items as fit into the back of a queue, using at
+ * most two memcpy() calls.  Returns the number of items copied.
+ */
+static UBaseType_t prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies up to the given number of items out of a queue, using at most two
+ * memcpy() calls.  Returns the number of items copied.
+ */
+static UBaseType_t prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxMaxItems ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks up to the given number of tasks waiting on an event list of a
+ * queue.  Must be called from a critical section.
+ *
+ * @return pdTRUE if any of the unblocked tasks has a priority higher than the
+ * calling task, otherwise pdFALSE.
+ */
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList, UBaseType_t uxTaskCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Lets the tasks waiting to receive from a queue, or the queue set the queue
+ * belongs to, know that the given number of items was added to the back of
+ * the queue.  Must be called from a critical section and with the queue
+ * unlocked.
+ *
+ * @return pdTRUE if a task with a priority higher than the calling task was
+ * unblocked, otherwise pdFALSE.
+ */
+static BaseType_t prvNotifyItemsAdded( Queue_t * const pxQueue, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds the number of items transferred while a queue was locked to the lock
+ * count, saturating at queueMAX_LOCK_COUNT.
+ */
+static int8_t prvAddToLockCount( const int8_t cLockCount, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -267,6 +326,13 @@ Queue_t * const pxQueue = xQueue;
 		pxQueue->cRxLock = queueUNLOCKED;
 		pxQueue->cTxLock = queueUNLOCKED;
 
+		#if ( configUSE_QUEUE_LOANS == 1 )
+		{
+			pxQueue->pcSendLoan = NULL;
+			pxQueue->pcReceiveLoan = NULL;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -771,7 +837,7 @@ Queue_t * const pxQueue = xQueue;
 			highest priority task wanting to access the queue.  If the head item
 			in the queue is to be overwritten then it does not matter if the
 			queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) && prvLoanAllowsSend( pxQueue, xCopyPosition ) )
 			{
 				traceQUEUE_SEND( pxQueue );
 
@@ -912,7 +978,7 @@ Queue_t * const pxQueue = xQueue;
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
 				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -987,7 +1053,7 @@ Queue_t * const pxQueue = xQueue;
 	post). */
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) && prvLoanAllowsSend( pxQueue, xCopyPosition ) )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
 
@@ -1302,7 +1368,7 @@ Queue_t * const pxQueue = xQueue;
 
 			/* Is there data in the queue now?  To be running the calling task
 			must be the highest priority task wanting to access the queue. */
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && prvLoanAllowsReceive( pxQueue ) )
 			{
 				/* Data available, remove one item. */
 				prvCopyDataFromQueue( pxQueue, pvBuffer );
@@ -1808,7 +1874,7 @@ Queue_t * const pxQueue = xQueue;
 		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
 		/* Cannot block in an ISR, so check there is data available. */
-		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+		if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && prvLoanAllowsReceive( pxQueue ) )
 		{
 			const int8_t cRxLock = pxQueue->cRxLock;
 
@@ -1923,149 +1989,810 @@ Queue_t * const pxQueue = xQueue;
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait )
 {
-UBaseType_t uxReturn;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxItemsSent;
+Queue_t * const pxQueue = xQueue;
 
-	configASSERT( xQueue );
+	configASSERT( pxQueue );
+	configASSERT( pvItemsToQueue );
 
-	taskENTER_CRITICAL();
+	/* Semaphores have to be given one by one. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 	}
-	taskEXIT_CRITICAL();
+	#endif
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+	/*lint -save -e904 This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	if( uxItemCount == ( UBaseType_t ) 0 )
+	{
+		return 0;
+	}
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Is there room for at least one item?  All items that fit are
+			copied and the receivers are notified within this one critical
+			section. */
+			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) && prvLoanAllowsSend( pxQueue, queueSEND_TO_BACK ) )
+			{
+				traceQUEUE_SEND( pxQueue );
 
-	configASSERT( pxQueue );
+				uxItemsSent = prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItemsToQueue, uxItemCount );
+				if( prvNotifyItemsAdded( pxQueue, uxItemsSent ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-	taskENTER_CRITICAL();
-	{
-		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
-	}
-	taskEXIT_CRITICAL();
+				taskEXIT_CRITICAL();
+				return ( BaseType_t ) uxItemsSent;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return errQUEUE_FULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
 
-	configASSERT( pxQueue );
-	uxReturn = pxQueue->uxMessagesWaiting;
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return errQUEUE_FULL;
+		}
+	} /*lint -restore */
+}
 /*-----------------------------------------------------------*/
 
-void vQueueDelete( QueueHandle_t xQueue )
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
 {
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
 Queue_t * const pxQueue = xQueue;
 
 	configASSERT( pxQueue );
-	traceQUEUE_DELETE( pxQueue );
+	configASSERT( pvItemsToQueue );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-	#if ( configQUEUE_REGISTRY_SIZE > 0 )
-	{
-		vQueueUnregisterQueue( pxQueue );
-	}
-	#endif
+	/* See the comment in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
-	{
-		/* The queue can only have been allocated dynamically - free it
-		again. */
-		vPortFree( pxQueue );
-	}
-	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		/* The queue could have been allocated statically or dynamically, so
-		check before attempting to free the memory. */
-		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		if( ( uxItemCount > ( UBaseType_t ) 0 ) && ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) && prvLoanAllowsSend( pxQueue, queueSEND_TO_BACK ) )
 		{
-			vPortFree( pxQueue );
+			const int8_t cTxLock = pxQueue->cTxLock;
+			UBaseType_t uxItemsSent;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			uxItemsSent = prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItemsToQueue, uxItemCount );
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( ( prvNotifyItemsAdded( pxQueue, uxItemsSent ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was posted while it was locked. */
+				pxQueue->cTxLock = prvAddToLockCount( cTxLock, uxItemsSent );
+			}
+
+			xReturn = ( BaseType_t ) uxItemsSent;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			xReturn = errQUEUE_FULL;
 		}
 	}
-	#else
-	{
-		/* The queue must have been statically allocated, so is not going to be
-		deleted.  Avoid compiler warnings about the unused parameter. */
-		( void ) pxQueue;
-	}
-	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
-	{
-		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
-	}
-
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxItemsReceived;
+Queue_t * const pxQueue = xQueue;
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
 
-	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	/* Semaphores have to be taken one by one. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 	}
+	#endif
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	/*lint -save -e904  This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	if( uxMaxItems == ( UBaseType_t ) 0 )
 	{
-		return ( ( Queue_t * ) xQueue )->ucQueueType;
+		return 0;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
-
-#if( configUSE_MUTEXES == 1 )
-
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	for( ;; )
 	{
-	UBaseType_t uxHighestPriorityOfWaitingTasks;
-
-		/* If a task waiting for a mutex causes the mutex holder to inherit a
-		priority, but the waiting task times out, then the holder should
-		disinherit the priority - but only down to the highest priority of any
-		other tasks that are waiting for the same mutex.  For this purpose,
-		return the priority of the highest priority task that is waiting for the
-		mutex. */
-		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
-		{
-			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
-		}
-		else
+		taskENTER_CRITICAL();
 		{
-			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
-		}
+			/* Is there at least one item?  All available items up to
+			uxMaxItems are copied and the senders are notified within this one
+			critical section. */
+			if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && prvLoanAllowsReceive( pxQueue ) )
+			{
+				uxItemsReceived = prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxMaxItems );
+				traceQUEUE_RECEIVE( pxQueue );
 
-		return uxHighestPriorityOfWaitingTasks;
-	}
+				if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
+				taskEXIT_CRITICAL();
+				return ( BaseType_t ) uxItemsReceived;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return errQUEUE_EMPTY;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The queue contains data again.  Loop back to try and read the
+				data. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* Timed out.  If there is no data in the queue exit, otherwise loop
+			back and attempt to read the data. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return errQUEUE_EMPTY;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comment in xQueueReceiveFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( ( uxMaxItems > ( UBaseType_t ) 0 ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && prvLoanAllowsReceive( pxQueue ) )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+			UBaseType_t uxItemsReceived;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			uxItemsReceived = prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxMaxItems );
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know that an ISR has removed data while the queue was
+			locked. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( ( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cRxLock = prvAddToLockCount( cRxLock, uxItemsReceived );
+			}
+
+			xReturn = ( BaseType_t ) uxItemsReceived;
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			xReturn = errQUEUE_EMPTY;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueAcquireSendSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ppvSlot );
+
+		/* Semaphores do not have any storage that could be loaned. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/*lint -save -e904 This function relaxes the coding standard somewhat to
+		allow return statements within the function itself.  This is done in the
+		interest of execution time efficiency. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* The same conditions as in xQueueGenericSend() apply, but the
+				slot is only reserved here.  The item becomes visible to the
+				receivers when xQueueCommitSend() is called. */
+				if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) && prvLoanAllowsSend( pxQueue, queueSEND_TO_BACK ) )
+				{
+					pxQueue->pcSendLoan = pxQueue->pcWriteTo;
+					*ppvSlot = ( void * ) pxQueue->pcSendLoan;
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						taskEXIT_CRITICAL();
+						traceQUEUE_SEND_FAILED( pxQueue );
+						return errQUEUE_FULL;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskInternalSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				traceQUEUE_SEND_FAILED( pxQueue );
+				return errQUEUE_FULL;
+			}
+		} /*lint -restore */
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueCommitSend( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			/* The slot must have been acquired by xQueueAcquireSendSlot(). */
+			configASSERT( pxQueue->pcSendLoan != NULL );
+
+			traceQUEUE_SEND( pxQueue );
+
+			/* The item has already been written in place, so it only has to be
+			added to the queue in the same way as prvCopyDataToQueue() does. */
+			pxQueue->pcSendLoan = NULL;
+			pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+			if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1;
+
+			if( prvNotifyItemsAdded( pxQueue, ( UBaseType_t ) 1 ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Other senders might have blocked only because the slot was
+			loaned. */
+			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) && ( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), ( UBaseType_t ) 1 ) != pdFALSE ) )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pdPASS;
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueAcquireReceiveSlot( QueueHandle_t xQueue, void ** const ppvSlot, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ppvSlot );
+
+		/* Semaphores do not have any storage that could be loaned. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/*lint -save -e904 This function relaxes the coding standard somewhat to
+		allow return statements within the function itself.  This is done in the
+		interest of execution time efficiency. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* The same conditions as in xQueueReceive() apply, but the item
+				stays in the queue until xQueueReleaseReceive() is called. */
+				if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && prvLoanAllowsReceive( pxQueue ) )
+				{
+					pxQueue->pcReceiveLoan = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+					if( pxQueue->pcReceiveLoan >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+					{
+						pxQueue->pcReceiveLoan = pxQueue->pcHead;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					*ppvSlot = ( void * ) pxQueue->pcReceiveLoan;
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						taskEXIT_CRITICAL();
+						traceQUEUE_RECEIVE_FAILED( pxQueue );
+						return errQUEUE_EMPTY;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskInternalSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* Timed out.  If there is no data in the queue exit, otherwise
+				loop back and attempt to acquire the slot. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+				{
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return errQUEUE_EMPTY;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		} /*lint -restore */
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_LOANS == 1 )
+
+	BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			/* The slot must have been acquired by xQueueAcquireReceiveSlot(). */
+			configASSERT( pxQueue->pcReceiveLoan != NULL );
+
+			traceQUEUE_RECEIVE( pxQueue );
+
+			/* Nothing could be placed in front of the loaned item, so it is
+			still the next one to be read. */
+			pxQueue->u.xQueue.pcReadFrom = pxQueue->pcReceiveLoan;
+			pxQueue->pcReceiveLoan = NULL;
+			pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
+
+			/* There is now space in the queue. */
+			if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), ( UBaseType_t ) 1 ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Other receivers might have blocked only because the slot was
+			loaned. */
+			if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), ( UBaseType_t ) 1 ) != pdFALSE ) )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pdPASS;
+	}
+
+#endif /* configUSE_QUEUE_LOANS */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+
+	configASSERT( xQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	uxReturn = pxQueue->uxMessagesWaiting;
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	traceQUEUE_DELETE( pxQueue );
+
+	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	{
+		vQueueUnregisterQueue( pxQueue );
+	}
+	#endif
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxQueue );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The queue could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		/* The queue must have been statically allocated, so is not going to be
+		deleted.  Avoid compiler warnings about the unused parameter. */
+		( void ) pxQueue;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	{
+		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->ucQueueType;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MUTEXES == 1 )
+
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	{
+	UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+		/* If a task waiting for a mutex causes the mutex holder to inherit a
+		priority, but the waiting task times out, then the holder should
+		disinherit the priority - but only down to the highest priority of any
+		other tasks that are waiting for the same mutex.  For this purpose,
+		return the priority of the highest priority task that is waiting for the
+		mutex. */
+		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+		{
+			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+		}
+		else
+		{
+			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+		}
+
+		return uxHighestPriorityOfWaitingTasks;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
 
 static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
 {
@@ -2095,7 +2822,7 @@ UBaseType_t uxMessagesWaiting;
 	}
 	else if( xPosition == queueSEND_TO_BACK )
 	{
-		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		configCOPY_DATA( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
 		pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
 		if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 		{
@@ -2108,7 +2835,7 @@ UBaseType_t uxMessagesWaiting;
 	}
 	else
 	{
-		( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
+		configCOPY_DATA( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
 		pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
 		if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 		{
@@ -2159,8 +2886,211 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		configCOPY_DATA( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount )
+{
+UBaseType_t uxItemsToCopy = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+size_t xBytesToCopy, xFirstBytes, xOffset;
+const size_t xStorageSize = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcHead );
+
+	/* This function is called from a critical section and never with a
+	semaphore, so there is no mutex holder to disinherit. */
+
+	if( uxItemCount < uxItemsToCopy )
+	{
+		uxItemsToCopy = uxItemCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The items are copied up to the end of the storage area and the rest, if
+	any, from its beginning. */
+	xBytesToCopy = ( size_t ) uxItemsToCopy * ( size_t ) pxQueue->uxItemSize;
+	xOffset = ( size_t ) ( pxQueue->pcWriteTo - pxQueue->pcHead );
+	xFirstBytes = xStorageSize - xOffset;
+	if( xFirstBytes > xBytesToCopy )
+	{
+		xFirstBytes = xBytesToCopy;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+	if( xBytesToCopy > xFirstBytes )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( pcItems[ xFirstBytes ] ), xBytesToCopy - xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xOffset += xBytesToCopy;
+	if( xOffset >= xStorageSize )
+	{
+		xOffset -= xStorageSize;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxQueue->pcWriteTo = &( pxQueue->pcHead[ xOffset ] );
+	pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + uxItemsToCopy;
+
+	return uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxMaxItems )
+{
+UBaseType_t uxItemsToCopy = pxQueue->uxMessagesWaiting;
+size_t xBytesToCopy, xFirstBytes, xOffset;
+const size_t xStorageSize = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcHead );
+
+	if( uxMaxItems < uxItemsToCopy )
+	{
+		uxItemsToCopy = uxMaxItems;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* pcReadFrom points to the last item read, so the first item to copy is
+	the one after it. */
+	xBytesToCopy = ( size_t ) uxItemsToCopy * ( size_t ) pxQueue->uxItemSize;
+	xOffset = ( size_t ) ( pxQueue->u.xQueue.pcReadFrom - pxQueue->pcHead ) + ( size_t ) pxQueue->uxItemSize;
+	if( xOffset >= xStorageSize )
+	{
+		xOffset = 0U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xFirstBytes = xStorageSize - xOffset;
+	if( xFirstBytes > xBytesToCopy )
+	{
+		xFirstBytes = xBytesToCopy;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pcBuffer, ( const void * ) &( pxQueue->pcHead[ xOffset ] ), xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+	if( xBytesToCopy > xFirstBytes )
+	{
+		( void ) memcpy( ( void * ) &( pcBuffer[ xFirstBytes ] ), ( const void * ) pxQueue->pcHead, xBytesToCopy - xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Leave pcReadFrom pointing to the last item copied. */
+	xOffset += xBytesToCopy - ( size_t ) pxQueue->uxItemSize;
+	if( xOffset >= xStorageSize )
+	{
+		xOffset -= xStorageSize;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxQueue->u.xQueue.pcReadFrom = &( pxQueue->pcHead[ xOffset ] );
+	pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting - uxItemsToCopy;
+
+	return uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList, UBaseType_t uxTaskCount )
+{
+BaseType_t xReturn = pdFALSE;
+
+	while( ( uxTaskCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		--uxTaskCount;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvNotifyItemsAdded( Queue_t * const pxQueue, const UBaseType_t uxItemCount )
+{
+BaseType_t xReturn = pdFALSE;
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			UBaseType_t uxItem;
+
+			/* The queue set holds one entry for each item in its member
+			queues. */
+			for( uxItem = 0; uxItem < uxItemCount; uxItem++ )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			xReturn = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+		}
 	}
+	#else /* configUSE_QUEUE_SETS */
+	{
+		xReturn = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static int8_t prvAddToLockCount( const int8_t cLockCount, const UBaseType_t uxItemCount )
+{
+int8_t cReturn;
+
+	if( uxItemCount >= ( UBaseType_t ) ( queueMAX_LOCK_COUNT - cLockCount ) )
+	{
+		cReturn = queueMAX_LOCK_COUNT;
+	}
+	else
+	{
+		cReturn = ( int8_t ) ( cLockCount + ( int8_t ) uxItemCount );
+	}
+
+	return cReturn;
 }
 /*-----------------------------------------------------------*/
 
@@ -2290,7 +3220,7 @@ BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 )
+		if( ( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 ) || ( prvLoanAllowsReceive( pxQueue ) == pdFALSE ) )
 		{
 			xReturn = pdTRUE;
 		}
@@ -2324,13 +3254,13 @@ Queue_t * const pxQueue = xQueue;
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xPosition )
 {
 BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+		if( ( ( pxQueue->uxMessagesWaiting == pxQueue->uxLength ) && ( xPosition != queueOVERWRITE ) ) || ( prvLoanAllowsSend( pxQueue, xPosition ) == pdFALSE ) )
 		{
 			xReturn = pdTRUE;
 		}
@@ -2376,7 +3306,7 @@ Queue_t * const pxQueue = xQueue;
 		between the check to see if the queue is full and blocking on the queue. */
 		portDISABLE_INTERRUPTS();
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
 			{
 				/* The queue is full - do we want to block or just leave without
 				posting? */
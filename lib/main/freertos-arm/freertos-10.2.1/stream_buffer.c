@@ -49,28 +49,56 @@ for the header files above, but not in this file, in order to generate the
 correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
 
+#if ( configUSE_STREAM_BUFFER_LOCK_FREE == 1 )
+	#if !defined( __GNUC__ )
+		#error configUSE_STREAM_BUFFER_LOCK_FREE requires a compiler that supports the GCC __atomic builtins.
+	#endif
+
+	/* A stream buffer has a single writer, which owns xHead, and a single
+	reader, which owns xTail.  Each side publishes its index with release
+	semantics only after the data it covers has been copied, and reads the
+	index of the other side with acquire semantics, so the data itself never has
+	to be protected by a critical section. */
+	#define sbLOAD_INDEX( xIndex )				__atomic_load_n( &( xIndex ), __ATOMIC_ACQUIRE )
+	#define sbSTORE_INDEX( xIndex, xValue )		__atomic_store_n( &( xIndex ), ( xValue ), __ATOMIC_RELEASE )
+
+	/* The notification macros only enter the kernel if the other side is
+	blocked.  The full barrier orders the publication of the index before the
+	check, so a task that registered itself as waiting before the index was
+	published is always seen. */
+	#define sbIS_TASK_WAITING( xTask )			( __atomic_thread_fence( __ATOMIC_SEQ_CST ), ( ( xTask ) != NULL ) )
+#else
+	#define sbLOAD_INDEX( xIndex )				( xIndex )
+	#define sbSTORE_INDEX( xIndex, xValue )		( xIndex ) = ( xValue )
+	#define sbIS_TASK_WAITING( xTask )			( pdTRUE )
+#endif /* configUSE_STREAM_BUFFER_LOCK_FREE */
+
 /* If the user has not provided application specific Rx notification macros,
 or #defined the notification macros away, them provide default implementations
 that uses task notifications. */
 /*lint -save -e9026 Function like macros allowed and needed here so they can be overidden. */
 #ifndef sbRECEIVE_COMPLETED
 	#define sbRECEIVE_COMPLETED( pxStreamBuffer )										\
-		vTaskSuspendAll();																\
+		if( sbIS_TASK_WAITING( ( pxStreamBuffer )->xTaskWaitingToSend ) )				\
 		{																				\
-			if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )						\
+			vTaskSuspendAll();															\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToSend,			\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
-				( pxStreamBuffer )->xTaskWaitingToSend = NULL;							\
+				if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )					\
+				{																		\
+					( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToSend,		\
+										  ( uint32_t ) 0,								\
+										  eNoAction );									\
+					( pxStreamBuffer )->xTaskWaitingToSend = NULL;						\
+				}																		\
 			}																			\
-		}																				\
-		( void ) xTaskResumeAll();
+			( void ) xTaskResumeAll();													\
+		}
 #endif /* sbRECEIVE_COMPLETED */
 
 #ifndef sbRECEIVE_COMPLETED_FROM_ISR
 	#define sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer,								\
 										  pxHigherPriorityTaskWoken )					\
+	if( sbIS_TASK_WAITING( ( pxStreamBuffer )->xTaskWaitingToSend ) )					\
 	{																					\
 	UBaseType_t uxSavedInterruptStatus;													\
 																						\
@@ -94,21 +122,25 @@ or #defined the notification macro away, them provide a default implementation
 that uses task notifications. */
 #ifndef sbSEND_COMPLETED
 	#define sbSEND_COMPLETED( pxStreamBuffer )											\
-		vTaskSuspendAll();																\
+		if( sbIS_TASK_WAITING( ( pxStreamBuffer )->xTaskWaitingToReceive ) )			\
 		{																				\
-			if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )						\
+			vTaskSuspendAll();															\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToReceive,		\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
-				( pxStreamBuffer )->xTaskWaitingToReceive = NULL;						\
+				if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )					\
+				{																		\
+					( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToReceive,	\
+										  ( uint32_t ) 0,								\
+										  eNoAction );									\
+					( pxStreamBuffer )->xTaskWaitingToReceive = NULL;					\
+				}																		\
 			}																			\
-		}																				\
-		( void ) xTaskResumeAll();
+			( void ) xTaskResumeAll();													\
+		}
 #endif /* sbSEND_COMPLETED */
 
 #ifndef sbSEND_COMPLETE_FROM_ISR
 	#define sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )		\
+	if( sbIS_TASK_WAITING( ( pxStreamBuffer )->xTaskWaitingToReceive ) )				\
 	{																					\
 	UBaseType_t uxSavedInterruptStatus;													\
 																						\
@@ -134,6 +166,19 @@ that uses task notifications. */
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_POWER_OF_TWO_LENGTH	( ( uint8_t ) 4 ) /* Set if the length of the buffer is a power of two, so indexes can be wrapped by masking. */
+
+/* Wraps an index that went past the end of the buffer by less than the buffer
+length back into the buffer. */
+#if ( configUSE_STREAM_BUFFER_LOCK_FREE == 1 )
+	#define sbWRAP_INDEX( pxStreamBuffer, xIndex )																		\
+		( ( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_POWER_OF_TWO_LENGTH ) != ( uint8_t ) 0 ) ?						\
+		  ( ( xIndex ) & ( ( pxStreamBuffer )->xLength - ( size_t ) 1 ) ) :											\
+		  ( ( ( xIndex ) >= ( pxStreamBuffer )->xLength ) ? ( ( xIndex ) - ( pxStreamBuffer )->xLength ) : ( xIndex ) ) )
+#else
+	#define sbWRAP_INDEX( pxStreamBuffer, xIndex )																		\
+		( ( ( xIndex ) >= ( pxStreamBuffer )->xLength ) ? ( ( xIndex ) - ( pxStreamBuffer )->xLength ) : ( xIndex ) )
+#endif /* configUSE_STREAM_BUFFER_LOCK_FREE */
 
 /*-----------------------------------------------------------*/
 
@@ -160,12 +205,12 @@ typedef struct StreamBufferDef_t /*lint !e9058 Style convention uses tag. */
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
 /*
- * Add xCount bytes from pucData into the pxStreamBuffer message buffer.
- * Returns the number of bytes written, which will either equal xCount in the
- * success case, or 0 if there was not enough space in the buffer (in which case
- * no data is written into the buffer).
+ * Add xCount bytes from pucData into the pxStreamBuffer message buffer,
+ * starting at xHead.  The caller must have checked there is enough space.
+ * Returns the head index following the written bytes, which still has to be
+ * stored in the stream buffer to make the bytes available to the reader.
  */
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount ) PRIVILEGED_FUNCTION;
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead ) PRIVILEGED_FUNCTION;
 
 /*
  * If the stream buffer is being used as a message buffer, then reads an entire
@@ -175,7 +220,7 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, cons
  * buffer's data storage area.
  */
 static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
-										void *pvRxData,
+										const StreamBufferSegment_t * const pxSegments,
 										size_t xBufferLengthBytes,
 										size_t xBytesAvailable,
 										size_t xBytesToStoreMessageLength ) PRIVILEGED_FUNCTION;
@@ -188,19 +233,69 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
  * data storage area.
  */
 static size_t prvWriteMessageToBuffer(  StreamBuffer_t * const pxStreamBuffer,
-										const void * pvTxData,
+										const StreamBufferSegment_t * const pxSegments,
 										size_t xDataLengthBytes,
 										size_t xSpace,
 										size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
 
 /*
- * Read xMaxCount bytes from the pxStreamBuffer message buffer and write them
- * to pucData.
+ * Read xCount bytes from the pxStreamBuffer message buffer, starting at xTail,
+ * and write them to pucData.  The caller must have checked that enough bytes
+ * are available.  Returns the tail index following the read bytes, which
+ * still has to be stored in the stream buffer to free the space for the
+ * writer.
  */
 static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  uint8_t *pucData,
-									  size_t xMaxCount,
-									  size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+									  size_t xCount,
+									  size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Scatter-gather versions of prvWriteBytesToBuffer() and
+ * prvReadBytesFromBuffer().  The xCount bytes are taken from, or stored to,
+ * the consecutive segments in pxSegments, which must be able to hold at least
+ * xCount bytes in total.
+ */
+static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+										const StreamBufferSegment_t *pxSegments,
+										size_t xCount,
+										size_t xHead ) PRIVILEGED_FUNCTION;
+static size_t prvReadSegmentsFromBuffer( StreamBuffer_t *pxStreamBuffer,
+										 const StreamBufferSegment_t *pxSegments,
+										 size_t xCount,
+										 size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks until at least
+ * xRequiredSpace bytes are free in the buffer, and returns the number of free
+ * bytes (which is lower than xRequiredSpace if the wait timed out).
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks until more than
+ * xBytesToStoreMessageLength bytes are available in the buffer, and returns
+ * the number of available bytes (which is not more than
+ * xBytesToStoreMessageLength if the wait timed out).
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets *ppvData to the head of the buffer and returns the number of bytes that
+ * can be written there without wrapping around the end of the buffer.
+ */
+static size_t prvContiguousSpace( StreamBuffer_t * const pxStreamBuffer, void ** const ppvData ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets *ppvData to the tail of the buffer and returns the number of bytes that
+ * can be read from there without wrapping around the end of the buffer.
+ */
+static size_t prvContiguousData( const StreamBuffer_t * const pxStreamBuffer, void ** const ppvData ) PRIVILEGED_FUNCTION;
+
+/*
+ * The total number of bytes in the xSegmentCount segments in pxSegments.
+ */
+static size_t prvSegmentsLength( const StreamBufferSegment_t * const pxSegments, size_t xSegmentCount ) PRIVILEGED_FUNCTION;
 
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
@@ -474,20 +569,11 @@ size_t xSpace;
 
 	configASSERT( pxStreamBuffer );
 
-	xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
-	xSpace -= pxStreamBuffer->xHead;
+	xSpace = pxStreamBuffer->xLength + sbLOAD_INDEX( pxStreamBuffer->xTail );
+	xSpace -= sbLOAD_INDEX( pxStreamBuffer->xHead );
 	xSpace -= ( size_t ) 1;
 
-	if( xSpace >= pxStreamBuffer->xLength )
-	{
-		xSpace -= pxStreamBuffer->xLength;
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	return xSpace;
+	return sbWRAP_INDEX( pxStreamBuffer, xSpace );
 }
 /*-----------------------------------------------------------*/
 
@@ -508,14 +594,33 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 						  size_t xDataLengthBytes,
 						  TickType_t xTicksToWait )
 {
-StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xSpace = 0;
-size_t xRequiredSpace = xDataLengthBytes;
-TimeOut_t xTimeOut;
+StreamBufferSegment_t xSegment;
 
 	configASSERT( pvTxData );
+
+	/* The data is only read, so casting the const away is safe. */
+	xSegment.pvData = ( void * ) pvTxData; /*lint !e9005 Data is not modified. */
+	xSegment.xLengthBytes = xDataLengthBytes;
+
+	return xStreamBufferSendV( xStreamBuffer, &xSegment, 1, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferSegment_t * const pxSegments,
+						   size_t xSegmentCount,
+						   TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn, xSpace;
+size_t xDataLengthBytes, xRequiredSpace;
+
+	configASSERT( pxSegments );
 	configASSERT( pxStreamBuffer );
 
+	xDataLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+	xRequiredSpace = xDataLengthBytes;
+
 	/* This send function is used to write to both message buffers and stream
 	buffers.  If this is a message buffer then the space needed must be
 	increased by the amount of bytes needed to store the length of the
@@ -532,56 +637,9 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		vTaskSetTimeOutState( &xTimeOut );
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
 
-		do
-		{
-			/* Wait until the required number of bytes are free in the message
-			buffer. */
-			taskENTER_CRITICAL();
-			{
-				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-				if( xSpace < xRequiredSpace )
-				{
-					/* Clear notification state as going to wait for space. */
-					( void ) xTaskNotifyStateClear( NULL );
-
-					/* Should only be one writer. */
-					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-				}
-				else
-				{
-					taskEXIT_CRITICAL();
-					break;
-				}
-			}
-			taskEXIT_CRITICAL();
-
-			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToSend = NULL;
-
-		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	if( xSpace == ( size_t ) 0 )
-	{
-		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxSegments, xDataLengthBytes, xSpace, xRequiredSpace );
 
 	if( xReturn > ( size_t ) 0 )
 	{
@@ -612,13 +670,33 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
 								 size_t xDataLengthBytes,
 								 BaseType_t * const pxHigherPriorityTaskWoken )
 {
+StreamBufferSegment_t xSegment;
+
+	configASSERT( pvTxData );
+
+	/* The data is only read, so casting the const away is safe. */
+	xSegment.pvData = ( void * ) pvTxData; /*lint !e9005 Data is not modified. */
+	xSegment.xLengthBytes = xDataLengthBytes;
+
+	return xStreamBufferSendVFromISR( xStreamBuffer, &xSegment, 1, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+								  const StreamBufferSegment_t * const pxSegments,
+								  size_t xSegmentCount,
+								  BaseType_t * const pxHigherPriorityTaskWoken )
+{
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
 size_t xReturn, xSpace;
-size_t xRequiredSpace = xDataLengthBytes;
+size_t xDataLengthBytes, xRequiredSpace;
 
-	configASSERT( pvTxData );
+	configASSERT( pxSegments );
 	configASSERT( pxStreamBuffer );
 
+	xDataLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+	xRequiredSpace = xDataLengthBytes;
+
 	/* This send function is used to write to both message buffers and stream
 	buffers.  If this is a message buffer then the space needed must be
 	increased by the amount of bytes needed to store the length of the
@@ -633,7 +711,7 @@ size_t xRequiredSpace = xDataLengthBytes;
 	}
 
 	xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxSegments, xDataLengthBytes, xSpace, xRequiredSpace );
 
 	if( xReturn > ( size_t ) 0 )
 	{
@@ -659,13 +737,14 @@ size_t xRequiredSpace = xDataLengthBytes;
 /*-----------------------------------------------------------*/
 
 static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-									   const void * pvTxData,
+									   const StreamBufferSegment_t * const pxSegments,
 									   size_t xDataLengthBytes,
 									   size_t xSpace,
 									   size_t xRequiredSpace )
 {
 	BaseType_t xShouldWrite;
 	size_t xReturn;
+	size_t xNextHead = pxStreamBuffer->xHead;
 
 	if( xSpace == ( size_t ) 0 )
 	{
@@ -688,7 +767,7 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 		into the buffer.  Start by writing the length of the data, the data
 		itself will be written later in this function. */
 		xShouldWrite = pdTRUE;
-		( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
 	}
 	else
 	{
@@ -698,8 +777,11 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 	if( xShouldWrite != pdFALSE )
 	{
-		/* Writes the data itself. */
-		xReturn = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+		/* Writes the data itself, then makes the length and the data available
+		to the reader at once. */
+		xNextHead = prvWriteSegmentsToBuffer( pxStreamBuffer, pxSegments, xDataLengthBytes, xNextHead );
+		sbSTORE_INDEX( pxStreamBuffer->xHead, xNextHead );
+		xReturn = xDataLengthBytes;
 	}
 	else
 	{
@@ -715,12 +797,30 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
 							 size_t xBufferLengthBytes,
 							 TickType_t xTicksToWait )
 {
-StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+StreamBufferSegment_t xSegment;
 
 	configASSERT( pvRxData );
+
+	xSegment.pvData = pvRxData;
+	xSegment.xLengthBytes = xBufferLengthBytes;
+
+	return xStreamBufferReceiveV( xStreamBuffer, &xSegment, 1, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+							  const StreamBufferSegment_t * const pxSegments,
+							  size_t xSegmentCount,
+							  TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength, xBufferLengthBytes;
+
+	configASSERT( pxSegments );
 	configASSERT( pxStreamBuffer );
 
+	xBufferLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+
 	/* This receive function is used by both message buffers, which store
 	discrete messages, and stream buffers, which store a continuous stream of
 	bytes.  Discrete messages include an additional
@@ -735,54 +835,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		/* Checking if there is data and clearing the notification state must be
-		performed atomically. */
-		taskENTER_CRITICAL();
-		{
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-
-			/* If this function was invoked by a message buffer read then
-			xBytesToStoreMessageLength holds the number of bytes used to hold
-			the length of the next discrete message.  If this function was
-			invoked by a stream buffer read then xBytesToStoreMessageLength will
-			be 0. */
-			if( xBytesAvailable <= xBytesToStoreMessageLength )
-			{
-				/* Clear notification state as going to wait for data. */
-				( void ) xTaskNotifyStateClear( NULL );
-
-				/* Should only be one reader. */
-				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		taskEXIT_CRITICAL();
-
-		if( xBytesAvailable <= xBytesToStoreMessageLength )
-		{
-			/* Wait for data to be available. */
-			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToReceive = NULL;
-
-			/* Recheck the data available after blocking. */
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	else
-	{
-		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-	}
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
 
 	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
 	holds the number of bytes used to store the message length) or a stream of
@@ -791,7 +844,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 	read bytes from the buffer. */
 	if( xBytesAvailable > xBytesToStoreMessageLength )
 	{
-		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
+		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxSegments, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
 
 		/* Was a task waiting for space in the buffer? */
 		if( xReceivedLength != ( size_t ) 0 )
@@ -817,7 +870,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xBytesAvailable, xOriginalTail;
+size_t xReturn, xBytesAvailable;
 configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 
 	configASSERT( pxStreamBuffer );
@@ -831,13 +884,9 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 			/* The number of bytes available is greater than the number of bytes
 			required to hold the length of the next message, so another message
 			is available.  Return its length without removing the length bytes
-			from the buffer.  A copy of the tail is stored so the buffer can be
-			returned to its prior state as the message is not actually being
-			removed from the buffer. */
-			xOriginalTail = pxStreamBuffer->xTail;
-			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, xBytesAvailable );
+			from the buffer, which is why the returned tail is not stored. */
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
 			xReturn = ( size_t ) xTempReturn;
-			pxStreamBuffer->xTail = xOriginalTail;
 		}
 		else
 		{
@@ -863,12 +912,30 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken )
 {
-StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+StreamBufferSegment_t xSegment;
 
 	configASSERT( pvRxData );
+
+	xSegment.pvData = pvRxData;
+	xSegment.xLengthBytes = xBufferLengthBytes;
+
+	return xStreamBufferReceiveVFromISR( xStreamBuffer, &xSegment, 1, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+									 const StreamBufferSegment_t * const pxSegments,
+									 size_t xSegmentCount,
+									 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength, xBufferLengthBytes;
+
+	configASSERT( pxSegments );
 	configASSERT( pxStreamBuffer );
 
+	xBufferLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+
 	/* This receive function is used by both message buffers, which store
 	discrete messages, and stream buffers, which store a continuous stream of
 	bytes.  Discrete messages include an additional
@@ -892,7 +959,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 	read bytes from the buffer. */
 	if( xBytesAvailable > xBytesToStoreMessageLength )
 	{
-		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
+		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxSegments, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
 
 		/* Was a task waiting for space in the buffer? */
 		if( xReceivedLength != ( size_t ) 0 )
@@ -916,22 +983,23 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 /*-----------------------------------------------------------*/
 
 static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
-										void *pvRxData,
+										const StreamBufferSegment_t * const pxSegments,
 										size_t xBufferLengthBytes,
 										size_t xBytesAvailable,
 										size_t xBytesToStoreMessageLength )
 {
-size_t xOriginalTail, xReceivedLength, xNextMessageLength;
+size_t xNextTail, xReceivedLength, xNextMessageLength;
 configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 
+	/* The tail is stored only once all the bytes have been read, so the
+	writer never sees space that still holds data. */
+	xNextTail = pxStreamBuffer->xTail;
+
 	if( xBytesToStoreMessageLength != ( size_t ) 0 )
 	{
 		/* A discrete message is being received.  First receive the length
-		of the message.  A copy of the tail is stored so the buffer can be
-		returned to its prior state if the length of the message is too
-		large for the provided buffer. */
-		xOriginalTail = pxStreamBuffer->xTail;
-		( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xBytesAvailable );
+		of the message. */
+		xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xNextTail );
 		xNextMessageLength = ( size_t ) xTempNextMessageLength;
 
 		/* Reduce the number of bytes available by the number of bytes just
@@ -943,9 +1011,8 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 		if( xNextMessageLength > xBufferLengthBytes )
 		{
 			/* The user has provided insufficient space to read the message
-			so return the buffer to its previous state (so the length of
-			the message is in the buffer again). */
-			pxStreamBuffer->xTail = xOriginalTail;
+			so leave the buffer in its previous state (so the length of the
+			message stays in the buffer). */
 			xNextMessageLength = 0;
 		}
 		else
@@ -961,12 +1028,203 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 	}
 
 	/* Read the actual data. */
-	xReceivedLength = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xNextMessageLength, xBytesAvailable ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+	xReceivedLength = configMIN( xNextMessageLength, xBytesAvailable );
+
+	if( xReceivedLength > ( size_t ) 0 )
+	{
+		xNextTail = prvReadSegmentsFromBuffer( pxStreamBuffer, pxSegments, xReceivedLength, xNextTail );
+		sbSTORE_INDEX( pxStreamBuffer->xTail, xNextTail );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
 	return xReceivedLength;
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 void ** const ppvData,
+							 TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+
+	/* Message buffers have to store the length in front of each message, which
+	cannot be done for data written directly into the storage area. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	( void ) prvWaitForSpace( pxStreamBuffer, 1, xTicksToWait );
+
+	return prvContiguousSpace( pxStreamBuffer, ppvData );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									void ** const ppvData )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	return prvContiguousSpace( pxStreamBuffer, ppvData );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+						  size_t xBytesWritten )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Only bytes inside the span returned by xStreamBufferReserve() can be
+	committed. */
+	configASSERT( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xHead + xBytesWritten ) <= pxStreamBuffer->xLength );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		sbSTORE_INDEX( pxStreamBuffer->xHead, sbWRAP_INDEX( pxStreamBuffer, pxStreamBuffer->xHead + xBytesWritten ) );
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								 size_t xBytesWritten,
+								 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xHead + xBytesWritten ) <= pxStreamBuffer->xLength );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		sbSTORE_INDEX( pxStreamBuffer->xHead, sbWRAP_INDEX( pxStreamBuffer, pxStreamBuffer->xHead + xBytesWritten ) );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer,
+						  void ** const ppvData,
+						  TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	( void ) prvWaitForData( pxStreamBuffer, 0, xTicksToWait );
+
+	return prvContiguousData( pxStreamBuffer, ppvData );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferPeekFromISR( StreamBufferHandle_t xStreamBuffer,
+								 void ** const ppvData )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	return prvContiguousData( pxStreamBuffer, ppvData );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+						   size_t xBytesRead )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Only bytes inside the span returned by xStreamBufferPeek() can be
+	consumed. */
+	configASSERT( xBytesRead <= prvBytesInBuffer( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xTail + xBytesRead ) <= pxStreamBuffer->xLength );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		sbSTORE_INDEX( pxStreamBuffer->xTail, sbWRAP_INDEX( pxStreamBuffer, pxStreamBuffer->xTail + xBytesRead ) );
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesRead );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+								  size_t xBytesRead,
+								  BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( xBytesRead <= prvBytesInBuffer( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xTail + xBytesRead ) <= pxStreamBuffer->xLength );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		sbSTORE_INDEX( pxStreamBuffer->xTail, sbWRAP_INDEX( pxStreamBuffer, pxStreamBuffer->xTail + xBytesRead ) );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesRead );
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
 {
 const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
@@ -976,8 +1234,8 @@ size_t xTail;
 	configASSERT( pxStreamBuffer );
 
 	/* True if no bytes are available. */
-	xTail = pxStreamBuffer->xTail;
-	if( pxStreamBuffer->xHead == xTail )
+	xTail = sbLOAD_INDEX( pxStreamBuffer->xTail );
+	if( sbLOAD_INDEX( pxStreamBuffer->xHead ) == xTail )
 	{
 		xReturn = pdTRUE;
 	}
@@ -1085,14 +1343,12 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead )
 {
-size_t xNextHead, xFirstLength;
+size_t xNextHead = xHead, xFirstLength;
 
 	configASSERT( xCount > ( size_t ) 0 );
 
-	xNextHead = pxStreamBuffer->xHead;
-
 	/* Calculate the number of bytes that can be added in the first write -
 	which may be less than the total number of bytes that need to be added if
 	the buffer will wrap back to the beginning. */
@@ -1100,7 +1356,7 @@ size_t xNextHead, xFirstLength;
 
 	/* Write as many bytes as can be written in the first write. */
 	configASSERT( ( xNextHead + xFirstLength ) <= pxStreamBuffer->xLength );
-	( void ) memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	configCOPY_DATA( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
 	/* If the number of bytes written was less than the number that could be
 	written in the first write... */
@@ -1108,7 +1364,7 @@ size_t xNextHead, xFirstLength;
 	{
 		/* ...then write the remaining bytes to the start of the buffer. */
 		configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+		configCOPY_DATA( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 	}
 	else
 	{
@@ -1116,93 +1372,288 @@ size_t xNextHead, xFirstLength;
 	}
 
 	xNextHead += xCount;
-	if( xNextHead >= pxStreamBuffer->xLength )
+
+	return sbWRAP_INDEX( pxStreamBuffer, xNextHead );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xTail )
+{
+size_t xFirstLength, xNextTail = xTail;
+
+	configASSERT( xCount > ( size_t ) 0 );
+
+	/* Calculate the number of bytes that can be read - which may be less than
+	the number wanted if the data wraps around to the start of the buffer. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+
+	/* Obtain the number of bytes it is possible to obtain in the first read.
+	Asserts check bounds of read and write. */
+	configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
+	configCOPY_DATA( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+	/* If the total number of wanted bytes is greater than the number that
+	could be read in the first read... */
+	if( xCount > xFirstLength )
 	{
-		xNextHead -= pxStreamBuffer->xLength;
+		/*...then read the remaining bytes from the start of the buffer. */
+		configCOPY_DATA( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
+	/* Move the tail past the data read from the buffer. */
+	xNextTail += xCount;
 
-	return xCount;
+	return sbWRAP_INDEX( pxStreamBuffer, xNextTail );
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer, const StreamBufferSegment_t *pxSegments, size_t xCount, size_t xHead )
 {
-size_t xCount, xFirstLength, xNextTail;
+size_t xNextHead = xHead, xSegmentLength;
 
-	/* Use the minimum of the wanted bytes and the available bytes. */
-	xCount = configMIN( xBytesAvailable, xMaxCount );
+	configASSERT( xCount > ( size_t ) 0 );
 
-	if( xCount > ( size_t ) 0 )
+	/* Gather the bytes from as many segments as needed, skipping the empty
+	ones. */
+	while( xCount > ( size_t ) 0 )
 	{
-		xNextTail = pxStreamBuffer->xTail;
+		xSegmentLength = configMIN( pxSegments->xLengthBytes, xCount );
 
-		/* Calculate the number of bytes that can be read - which may be
-		less than the number wanted if the data wraps around to the start of
-		the buffer. */
-		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+		if( xSegmentLength > ( size_t ) 0 )
+		{
+			xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxSegments->pvData, xSegmentLength, xNextHead ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+			xCount -= xSegmentLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxSegments++;
+	}
 
-		/* Obtain the number of bytes it is possible to obtain in the first
-		read.  Asserts check bounds of read and write. */
-		configASSERT( xFirstLength <= xMaxCount );
-		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-		( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	return xNextHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadSegmentsFromBuffer( StreamBuffer_t *pxStreamBuffer, const StreamBufferSegment_t *pxSegments, size_t xCount, size_t xTail )
+{
+size_t xNextTail = xTail, xSegmentLength;
 
-		/* If the total number of wanted bytes is greater than the number
-		that could be read in the first read... */
-		if( xCount > xFirstLength )
+	configASSERT( xCount > ( size_t ) 0 );
+
+	/* Scatter the bytes into as many segments as needed, skipping the empty
+	ones. */
+	while( xCount > ( size_t ) 0 )
+	{
+		xSegmentLength = configMIN( pxSegments->xLengthBytes, xCount );
+
+		if( xSegmentLength > ( size_t ) 0 )
 		{
-			/*...then read the remaining bytes from the start of the buffer. */
-			configASSERT( xCount <= xMaxCount );
-			( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+			xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pxSegments->pvData, xSegmentLength, xNextTail ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+			xCount -= xSegmentLength;
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		/* Move the tail pointer to effectively remove the data read from
-		the buffer. */
-		xNextTail += xCount;
+		pxSegments++;
+	}
+
+	return xNextTail;
+}
+/*-----------------------------------------------------------*/
 
-		if( xNextTail >= pxStreamBuffer->xLength )
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait )
+{
+size_t xSpace;
+TimeOut_t xTimeOut;
+
+	#if ( configUSE_STREAM_BUFFER_LOCK_FREE == 1 )
+	{
+		/* Only the writer can reduce the space, so if there is enough space
+		already the critical section below is not needed. */
+		if( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= xRequiredSpace )
 		{
-			xNextTail -= pxStreamBuffer->xLength;
+			xTicksToWait = ( TickType_t ) 0;
 		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_STREAM_BUFFER_LOCK_FREE */
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* Wait until the required number of bytes are free in the message
+			buffer. */
+			taskENTER_CRITICAL();
+			{
+				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					/* Should only be one writer. */
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
 
-		pxStreamBuffer->xTail = xNextTail;
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	return xCount;
+	/* Whether the wait succeeded or timed out, return the space that is free
+	now. */
+	return xStreamBufferSpacesAvailable( pxStreamBuffer );
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait )
 {
-/* Returns the distance between xTail and xHead. */
-size_t xCount;
+size_t xBytesAvailable;
 
-	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
-	xCount -= pxStreamBuffer->xTail;
-	if ( xCount >= pxStreamBuffer->xLength )
+	#if ( configUSE_STREAM_BUFFER_LOCK_FREE == 1 )
 	{
-		xCount -= pxStreamBuffer->xLength;
+		/* Only the reader can remove data, so if there is data already the
+		critical section below is not needed. */
+		if( prvBytesInBuffer( pxStreamBuffer ) > xBytesToStoreMessageLength )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_STREAM_BUFFER_LOCK_FREE */
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			/* If this function was invoked by a message buffer read then
+			xBytesToStoreMessageLength holds the number of bytes used to hold
+			the length of the next discrete message.  If this function was
+			invoked by a stream buffer read then xBytesToStoreMessageLength will
+			be 0. */
+			if( xBytesAvailable <= xBytesToStoreMessageLength )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+			/* Recheck the data available after blocking. */
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 	}
 
-	return xCount;
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvContiguousSpace( StreamBuffer_t * const pxStreamBuffer, void ** const ppvData )
+{
+size_t xHead = pxStreamBuffer->xHead;
+
+	*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xHead ] );
+
+	return configMIN( xStreamBufferSpacesAvailable( pxStreamBuffer ), pxStreamBuffer->xLength - xHead );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvContiguousData( const StreamBuffer_t * const pxStreamBuffer, void ** const ppvData )
+{
+size_t xTail = pxStreamBuffer->xTail;
+
+	*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xTail ] );
+
+	return configMIN( prvBytesInBuffer( pxStreamBuffer ), pxStreamBuffer->xLength - xTail );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSegmentsLength( const StreamBufferSegment_t * const pxSegments, size_t xSegmentCount )
+{
+size_t xLength = 0, xSegment;
+
+	for( xSegment = 0; xSegment < xSegmentCount; xSegment++ )
+	{
+		configASSERT( ( pxSegments[ xSegment ].pvData != NULL ) || ( pxSegments[ xSegment ].xLengthBytes == ( size_t ) 0 ) );
+
+		xLength += pxSegments[ xSegment ].xLengthBytes;
+
+		/* Overflow? */
+		configASSERT( xLength >= pxSegments[ xSegment ].xLengthBytes );
+	}
+
+	return xLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+/* Returns the distance between xTail and xHead. */
+size_t xCount;
+
+	xCount = pxStreamBuffer->xLength + sbLOAD_INDEX( pxStreamBuffer->xHead );
+	xCount -= sbLOAD_INDEX( pxStreamBuffer->xTail );
+
+	return sbWRAP_INDEX( pxStreamBuffer, xCount );
 }
 /*-----------------------------------------------------------*/
 
@@ -1230,6 +1681,19 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 	pxStreamBuffer->xLength = xBufferSizeBytes;
 	pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
 	pxStreamBuffer->ucFlags = ucFlags;
+
+	#if ( configUSE_STREAM_BUFFER_LOCK_FREE == 1 )
+	{
+		if( ( xBufferSizeBytes & ( xBufferSizeBytes - ( size_t ) 1 ) ) == ( size_t ) 0 )
+		{
+			pxStreamBuffer->ucFlags |= sbFLAGS_IS_POWER_OF_TWO_LENGTH;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_STREAM_BUFFER_LOCK_FREE */
 }
 
 #if ( configUSE_TRACE_FACILITY == 1 )
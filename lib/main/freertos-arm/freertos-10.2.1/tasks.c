@@ -40,6 +40,14 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "stack_macros.h"
 
+#if ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 )
+	#include "priority_bitmap.h"
+#endif
+
+#if ( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+	#include "timing_wheel.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -83,7 +91,7 @@ functions but without including stdio.h here. */
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
 set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) )
 	#define tskSET_NEW_STACKS_TO_KNOWN_VALUE	1
 #else
 	#define tskSET_NEW_STACKS_TO_KNOWN_VALUE	0
@@ -112,7 +120,44 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configIDLE_TASK_NAME "IDLE"
 #endif
 
-#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+#if ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 )
+
+	/* If configUSE_PRIORITY_BITMAP_TASK_SELECTION is 1 then task selection is
+	performed in a generic way, but in constant time.  Every ready priority is
+	marked in xReadyPriorityBitmap, so the highest priority that contains ready
+	tasks is found without scanning the ready lists.  See priority_bitmap.h. */
+	#define taskRECORD_READY_PRIORITY( uxPriority )	vPriorityBitmapSet( &xReadyPriorityBitmap, ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define taskSELECT_HIGHEST_PRIORITY_TASK()														\
+	{																								\
+	UBaseType_t uxTopPriority;																		\
+																									\
+		/* Find the highest priority list that contains ready tasks. */								\
+		uxTopPriority = uxPriorityBitmapGetHighest( &xReadyPriorityBitmap );						\
+		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
+		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		uxTopReadyPriority = uxTopPriority;															\
+	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+	/*-----------------------------------------------------------*/
+
+	/* Clear the bit of the priority only if the TCB being reset was the last
+	one in its ready list.  If it is referenced from a delayed or suspended list
+	then it won't be in a ready list. */
+	#define taskRESET_READY_PRIORITY( uxPriority )														\
+	{																									\
+		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 )	\
+		{																								\
+			portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );							\
+		}																								\
+	}
+
+	/* Used directly where it is known that the ready list has become empty. */
+	#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )	vPriorityBitmapClear( &xReadyPriorityBitmap, ( uxPriority ) )
+
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
 	performed in a generic way that is not optimised to any particular
@@ -193,14 +238,38 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+
+	/* If configUSE_DELAYED_LIST_TIMING_WHEEL is 1 then the delayed tasks are
+	stored in timing wheels instead of lists sorted by the wake time, so
+	blocking with a timeout takes constant time regardless of the number of
+	tasks that are already delayed.  See timing_wheel.h. */
+	typedef TimingWheel_t DelayedList_t;
+
+	#define taskDELAYED_LIST_INITIALISE( pxDelayedList )			vTimingWheelInitialise( pxDelayedList )
+	#define taskDELAYED_LIST_INSERT( pxDelayedList, pxListItem )	vTimingWheelInsert( ( pxDelayedList ), ( pxListItem ) )
+	#define taskDELAYED_LIST_IS_EMPTY( pxDelayedList )				xTimingWheelIsEmpty( pxDelayedList )
+
+#else /* configUSE_DELAYED_LIST_TIMING_WHEEL */
+
+	typedef List_t DelayedList_t;
+
+	#define taskDELAYED_LIST_INITIALISE( pxDelayedList )			vListInitialise( pxDelayedList )
+	#define taskDELAYED_LIST_INSERT( pxDelayedList, pxListItem )	vListInsert( ( pxDelayedList ), ( pxListItem ) )
+	#define taskDELAYED_LIST_IS_EMPTY( pxDelayedList )				listLIST_IS_EMPTY( pxDelayedList )
+
+#endif /* configUSE_DELAYED_LIST_TIMING_WHEEL */
+
+/*-----------------------------------------------------------*/
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
 {																									\
-	List_t *pxTemp;																					\
+	DelayedList_t *pxTemp;																			\
 																									\
 	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+	configASSERT( ( taskDELAYED_LIST_IS_EMPTY( pxDelayedTaskList ) ) );								\
 																									\
 	pxTemp = pxDelayedTaskList;																		\
 	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
@@ -211,6 +280,26 @@ count overflows. */
 
 /*-----------------------------------------------------------*/
 
+/*
+ * Stores the time at which the task represented by pxTCB was made ready, so the
+ * latency until it is switched in can be measured by vTaskSwitchContext().
+ * Tasks made ready before the scheduler is started and the running task (e.g.
+ * moved to the end of its ready list on a yield) are not measured.
+ */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	#define taskRECORD_READY_TIME( pxTCB )																\
+	{																									\
+		if( ( xSchedulerRunning != pdFALSE ) && ( ( pxTCB ) != pxCurrentTCB ) )							\
+		{																								\
+			( pxTCB )->ulReadyTime = prvGetRunTimeCounterValue();										\
+		}																								\
+	}
+#else
+	#define taskRECORD_READY_TIME( pxTCB )
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+/*-----------------------------------------------------------*/
+
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
@@ -218,6 +307,7 @@ count overflows. */
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
+	taskRECORD_READY_TIME( pxTCB );																	\
 	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
@@ -290,7 +380,16 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 	#endif
 
 	#if( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+		configRUN_TIME_COUNTER_TYPE	ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+		configRUN_TIME_COUNTER_TYPE	ulReadyTime;		/*< Stores the run time counter value when the task was made ready, or 0 if the task is not waiting to be switched in. */
+		configRUN_TIME_COUNTER_TYPE	ulMaxLatency;		/*< Stores the longest time between the task being made ready and being switched in. */
+		uint32_t		ulSwitchCount;						/*< Stores the number of times the task was switched in. */
+		uint32_t		ulLatencyHistogram[ configRUN_TIME_STATS_LATENCY_BUCKETS ];	/*< Stores the number of switches in each latency range, see taskLATENCY_BUCKET_LIMIT(). */
+	#endif
+
+	#if( configUSE_TASK_FPU_CONTROL == 1 )
+		BaseType_t		xFPUFree;			/*< Set to pdTRUE if the task never uses the floating point unit. */
+		uint32_t		ulFPUSwitchCount;	/*< Stores the number of times the task was switched out with its floating point context. */
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
@@ -338,10 +437,10 @@ xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
 doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+PRIVILEGED_DATA static DelayedList_t xDelayedTaskList1;					/*< Delayed tasks. */
+PRIVILEGED_DATA static DelayedList_t xDelayedTaskList2;					/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+PRIVILEGED_DATA static DelayedList_t * volatile pxDelayedTaskList;		/*< Points to the delayed task list currently being used. */
+PRIVILEGED_DATA static DelayedList_t * volatile pxOverflowDelayedTaskList;	/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -367,6 +466,9 @@ the errno of the currently running task. */
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
+#if ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 )
+	PRIVILEGED_DATA static PriorityBitmap_t xReadyPriorityBitmap;		/*< Marks the priorities that have ready tasks. */
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile UBaseType_t uxPendedTicks 			= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
@@ -389,8 +491,8 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 	/* Do not move these variables to function scope as doing so prevents the
 	code working with debuggers that need to remove the static qualifier. */
-	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
-	PRIVILEGED_DATA static uint32_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
 
@@ -475,17 +577,42 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
  */
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configGENERATE_RUN_TIME_STATS == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) )
+
+	/*
+	 * Function called by prvForEachTask() for each task in the system.  uxIndex
+	 * is the position of the task in the walk, eState is the state implied by
+	 * the list the task was found in.
+	 */
+	typedef void ( *TaskVisitor_t )( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext );
+
+	/*
+	 * Calls pxVisitor for each task referenced from the pxList list (which may
+	 * be a ready list, a delayed list, a suspended list, etc.).  The tasks are
+	 * numbered from uxIndex.  Returns the index following the last task.
+	 */
+	static UBaseType_t prvForEachTaskWithinSingleList( List_t *pxList, eTaskState eState, TaskVisitor_t pxVisitor, void *pvContext, UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Calls pxVisitor for each task in the system: the ready tasks from the
+	 * highest priority, the blocked tasks, the tasks that have been deleted but
+	 * not yet cleaned up and the suspended tasks, in this order.  Must be called
+	 * with the scheduler suspended.  Returns the number of tasks visited.
+	 */
+	static UBaseType_t prvForEachTask( TaskVisitor_t pxVisitor, void *pvContext ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
- * Fills an TaskStatus_t structure with information on each task that is
- * referenced from the pxList list (which may be a ready list, a delayed list,
- * a suspended list, etc.).
+ * Fills an TaskStatus_t structure in the pvContext array with information on
+ * the task.  Used with prvForEachTask().
  *
  * THIS FUNCTION IS INTENDED FOR DEBUGGING ONLY, AND SHOULD NOT BE CALLED FROM
  * NORMAL APPLICATION CODE.
  */
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState ) PRIVILEGED_FUNCTION;
+	static void prvGetTaskStatus( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext ) PRIVILEGED_FUNCTION;
 
 #endif
 
@@ -504,12 +631,33 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  * This function determines the 'high water mark' of the task stack by
  * determining how much of the stack remains at the original preset value.
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) )
 
 	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
 
 #endif
 
+/*
+ * Fills a TaskStackStats_t structure with the stack usage of the task.
+ * prvGetStackStats() fills the structure at uxIndex in the pvContext array,
+ * prvGetStackStatsAtIndex() only the one selected by the StackStatsQuery_t
+ * pointed to by pvContext.  Used with prvForEachTask().
+ */
+#if ( INCLUDE_uxTaskGetStackStats == 1 )
+
+	typedef struct xSTACK_STATS_QUERY
+	{
+		UBaseType_t uxIndex;		/* The index of the task to be checked. */
+		TaskStackStats_t *pxStats;	/* The structure to be filled. */
+		BaseType_t xFound;			/* Set to pdTRUE when the task was found. */
+	} StackStatsQuery_t;
+
+	static void prvFillStackStats( TCB_t *pxTCB, TaskStackStats_t *pxStats ) PRIVILEGED_FUNCTION;
+	static void prvGetStackStats( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext ) PRIVILEGED_FUNCTION;
+	static void prvGetStackStatsAtIndex( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Return the amount of time, in ticks, that will pass before the kernel will
  * next move a task from the Blocked state to the Running state.
@@ -531,6 +679,23 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	/*
+	 * Returns the current value of the run time counter, using the port
+	 * provided portGET_RUN_TIME_COUNTER_VALUE() or
+	 * portALT_GET_RUN_TIME_COUNTER_VALUE() macro.
+	 */
+	static configRUN_TIME_COUNTER_TYPE prvGetRunTimeCounterValue( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Fills a TaskRunTimeStats_t structure at uxIndex in the pvContext array
+	 * with the run time statistics of the task.  Used with prvForEachTask().
+	 */
+	static void prvGetRunTimeStats( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -961,9 +1126,20 @@ UBaseType_t x;
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
 	{
 		pxNewTCB->ulRunTimeCounter = 0UL;
+		pxNewTCB->ulReadyTime = 0UL;
+		pxNewTCB->ulMaxLatency = 0UL;
+		pxNewTCB->ulSwitchCount = 0UL;
+		( void ) memset( ( void * ) pxNewTCB->ulLatencyHistogram, 0x00, sizeof( pxNewTCB->ulLatencyHistogram ) );
 	}
 	#endif /* configGENERATE_RUN_TIME_STATS */
 
+	#if ( configUSE_TASK_FPU_CONTROL == 1 )
+	{
+		pxNewTCB->xFPUFree = pdFALSE;
+		pxNewTCB->ulFPUSwitchCount = 0UL;
+	}
+	#endif /* configUSE_TASK_FPU_CONTROL */
+
 	#if ( portUSING_MPU_WRAPPERS == 1 )
 	{
 		vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
@@ -1378,7 +1554,8 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	eTaskState eTaskGetState( TaskHandle_t xTask )
 	{
 	eTaskState eReturn;
-	List_t const * pxStateList, *pxDelayedList, *pxOverflowedDelayedList;
+	List_t const * pxStateList;
+	DelayedList_t const * pxDelayedList, *pxOverflowedDelayedList;
 	const TCB_t * const pxTCB = xTask;
 
 		configASSERT( pxTCB );
@@ -1398,7 +1575,11 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+				if( ( xTimingWheelContainsList( pxDelayedList, pxStateList ) != pdFALSE ) || ( xTimingWheelContainsList( pxOverflowedDelayedList, pxStateList ) != pdFALSE ) )
+			#else
+				if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			#endif
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -2058,6 +2239,15 @@ BaseType_t xReturn;
 		FreeRTOSConfig.h file. */
 		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			/* The counter may have been running long before the scheduler was
+			started, that time must not be accounted to the first task. */
+			ulTaskSwitchedInTime = prvGetRunTimeCounterValue();
+			( pxCurrentTCB->ulSwitchCount )++;
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
 		traceTASK_SWITCHED_IN();
 
 		/* Setting up the timer tick is hardware specific and thus in the
@@ -2119,7 +2309,16 @@ void vTaskSuspendAll( void )
 		configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
 		task that are in the Ready state, even though the idle task is
 		running. */
-		#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		#if( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 )
+		{
+			/* uxTopReadyPriority is only updated when a task is selected, so
+			check the bitmap for tasks readied since then. */
+			if( uxPriorityBitmapGetHighest( &xReadyPriorityBitmap ) > tskIDLE_PRIORITY )
+			{
+				uxHigherPriorityReadyTasks = pdTRUE;
+			}
+		}
+		#elif( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 		{
 			if( uxTopReadyPriority > tskIDLE_PRIORITY )
 			{
@@ -2327,6 +2526,28 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
+uint64_t ullTaskGetTickCount64( void )
+{
+uint64_t ullReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* See the comment in xTaskGetTickCountFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Ticks pended while the scheduler is suspended are included, so the
+		returned count never stalls.  The overflow count is incremented only
+		when the pended ticks are processed, so the 64-bit sum is still exact. */
+		ullReturn = ( ( uint64_t ) ( UBaseType_t ) xNumOfOverflows << ( sizeof( TickType_t ) * 8U ) );
+		ullReturn += ( uint64_t ) xTickCount + ( uint64_t ) uxPendedTicks;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ullReturn;
+}
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxTaskGetNumberOfTasks( void )
 {
 	/* A critical section is not required because the variables are of type
@@ -2442,15 +2663,33 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+			UBaseType_t uxBucket;
+
+				for( uxBucket = ( UBaseType_t ) 0U; ( uxBucket < ( UBaseType_t ) configTIMING_WHEEL_SIZE ) && ( pxTCB == NULL ); uxBucket++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( pxDelayedTaskList->xBuckets[ uxBucket ] ), pcNameToQuery );
 
-			if( pxTCB == NULL )
+					if( pxTCB == NULL )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( &( pxOverflowDelayedTaskList->xBuckets[ uxBucket ] ), pcNameToQuery );
+					}
+				}
+			}
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
 			}
+			#endif
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2482,9 +2721,9 @@ TCB_t *pxTCB;
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
 	{
-	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	UBaseType_t uxTask = 0;
 
 		vTaskSuspendAll();
 		{
@@ -2492,44 +2731,14 @@ TCB_t *pxTCB;
 			if( uxArraySize >= uxCurrentNumberOfTasks )
 			{
 				/* Fill in an TaskStatus_t structure with information on each
-				task in the Ready state. */
-				do
-				{
-					uxQueue--;
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-
-				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
-
-				#if( INCLUDE_vTaskDelete == 1 )
-				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task that has been deleted but not yet cleaned up. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-				}
-				#endif
-
-				#if ( INCLUDE_vTaskSuspend == 1 )
-				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task in the Suspended state. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-				}
-				#endif
+				task in the system. */
+				uxTask = prvForEachTask( prvGetTaskStatus, ( void * ) pxTaskStatusArray );
 
 				#if ( configGENERATE_RUN_TIME_STATS == 1)
 				{
 					if( pulTotalRunTime != NULL )
 					{
-						#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-						#else
-							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-						#endif
+						*pulTotalRunTime = prvGetRunTimeCounterValue();
 					}
 				}
 				#else
@@ -2554,6 +2763,52 @@ TCB_t *pxTCB;
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	UBaseType_t uxTaskGetRunTimeStats( TaskRunTimeStats_t * const pxStatsArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+	{
+	UBaseType_t uxTask = 0, x;
+	configRUN_TIME_COUNTER_TYPE ulNow;
+
+		vTaskSuspendAll();
+		{
+			/* Is there a space in the array for each task in the system? */
+			if( uxArraySize >= uxCurrentNumberOfTasks )
+			{
+				/* Tasks are visited in the same order as by
+				uxTaskGetSystemState(). */
+				uxTask = prvForEachTask( prvGetRunTimeStats, ( void * ) pxStatsArray );
+
+				/* The run time of the calling task is only accumulated when it
+				is switched out, so add the time it has been running since. */
+				ulNow = prvGetRunTimeCounterValue();
+				for( x = 0; x < uxTask; x++ )
+				{
+					if( ( pxStatsArray[ x ].xHandle == pxCurrentTCB ) && ( ulNow > ulTaskSwitchedInTime ) )
+					{
+						pxStatsArray[ x ].ulRunTimeCounter += ( ulNow - ulTaskSwitchedInTime );
+						break;
+					}
+				}
+
+				if( pulTotalRunTime != NULL )
+				{
+					*pulTotalRunTime = ulNow;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return uxTask;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*----------------------------------------------------------*/
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
 	TaskHandle_t xTaskGetIdleTaskHandle( void )
@@ -2697,16 +2952,40 @@ BaseType_t xSwitchRequired = pdFALSE;
 		look any further down the list. */
 		if( xConstTickCount >= xNextTaskUnblockTime )
 		{
+		#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+			/* The timing wheel is not sorted, so first move the tasks whose
+			wake time has passed to a temporary list sorted by the wake time.
+			xNextTaskUnblockTime is never later than the earliest wake time,
+			so only the buckets of the ticks since then have to be visited. */
+			List_t xExpiredTaskList;
+			List_t * const pxUnblockList = &xExpiredTaskList;
+
+			vListInitialise( &xExpiredTaskList );
+			vTimingWheelCollectExpired( pxDelayedTaskList, xNextTaskUnblockTime, xConstTickCount, &xExpiredTaskList );
+		#else
+			List_t * const pxUnblockList = pxDelayedTaskList;
+		#endif
+
 			for( ;; )
 			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				if( listLIST_IS_EMPTY( pxUnblockList ) != pdFALSE )
 				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+					{
+						/* All expired tasks have been unblocked, find the
+						wake time of the next one remaining in the wheel. */
+						prvResetNextTaskUnblockTime();
+					}
+					#else
+					{
+						/* The delayed list is empty.  Set xNextTaskUnblockTime
+						to the maximum possible value so it is extremely
+						unlikely that the
+						if( xTickCount >= xNextTaskUnblockTime ) test will pass
+						next time through. */
+						xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					#endif
 					break;
 				}
 				else
@@ -2715,7 +2994,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 					item at the head of the delayed list.  This is the time
 					at which the task at the head of the delayed list must
 					be removed from the Blocked state. */
-					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxUnblockList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
 
 					if( xConstTickCount < xItemValue )
@@ -2944,8 +3223,57 @@ BaseType_t xSwitchRequired = pdFALSE;
 #endif /* configUSE_APPLICATION_TASK_TAG */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_FPU_CONTROL == 1 )
+
+	void vTaskSetFPUFree( TaskHandle_t xTask, BaseType_t xFPUFree )
+	{
+	TCB_t *pxTCB;
+
+		/* If xTask is NULL then the calling task is being marked. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		/* Only read when the task is switched out, a single word write needs
+		no critical section. */
+		pxTCB->xFPUFree = xFPUFree;
+	}
+
+#endif /* configUSE_TASK_FPU_CONTROL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_FPU_CONTROL == 1 )
+
+	void vTaskDropFPUContext( void )
+	{
+		/* See the description in task.h - callers up the stack may keep
+		values in the callee-saved floating point registers, so this is only
+		safe at the top of the entry loop of the task. */
+		portDROP_FPU_CONTEXT();
+	}
+
+#endif /* configUSE_TASK_FPU_CONTROL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_FPU_CONTROL == 1 )
+
+	uint32_t ulTaskGetFPUSwitchCount( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+
+		/* If xTask is NULL then the value of the calling task is returned. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		return pxTCB->ulFPUSwitchCount;
+	}
+
+#endif /* configUSE_TASK_FPU_CONTROL */
+/*-----------------------------------------------------------*/
+
 void vTaskSwitchContext( void )
 {
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	TCB_t * const pxPreviousTCB = pxCurrentTCB;
+#endif
+
 	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
 	{
 		/* The scheduler is currently suspended - do not allow a context
@@ -2957,13 +3285,15 @@ void vTaskSwitchContext( void )
 		xYieldPending = pdFALSE;
 		traceTASK_SWITCHED_OUT();
 
+		#if( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			vCriticalProfilerTaskSwitch();
+		}
+		#endif
+
 		#if ( configGENERATE_RUN_TIME_STATS == 1 )
 		{
-			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-				portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-			#else
-				ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-			#endif
+			ulTotalRunTime = prvGetRunTimeCounterValue();
 
 			/* Add the amount of time the task has been running to the
 			accumulated time so far.  The time the task started running was
@@ -2987,6 +3317,24 @@ void vTaskSwitchContext( void )
 		/* Check for stack overflow, if configured. */
 		taskCHECK_FOR_STACK_OVERFLOW();
 
+		/* The port has already saved the context of the task, so it is known
+		whether the floating point registers were saved with it.  A task marked
+		as FPU-free has no floating point state, so its context must have been
+		saved without them - otherwise the task used the FPU after all. */
+		#if( configUSE_TASK_FPU_CONTROL == 1 )
+		{
+			if( portTASK_FPU_CONTEXT_SAVED( pxCurrentTCB->pxTopOfStack ) )
+			{
+				configASSERT( pxCurrentTCB->xFPUFree == pdFALSE );
+				( pxCurrentTCB->ulFPUSwitchCount )++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
 		/* Before the currently running task is switched out, save its errno. */
 		#if( configUSE_POSIX_ERRNO == 1 )
 		{
@@ -2999,6 +3347,53 @@ void vTaskSwitchContext( void )
 		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 		traceTASK_SWITCHED_IN();
 
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			if( pxCurrentTCB != pxPreviousTCB )
+			{
+				( pxCurrentTCB->ulSwitchCount )++;
+
+				/* Account the time the task has been waiting in the Ready
+				state, if it was measured when the task was made ready.  The
+				histogram buckets grow by powers of two, so the bucket is found
+				by shifting instead of dividing. */
+				if( pxCurrentTCB->ulReadyTime != 0UL )
+				{
+				configRUN_TIME_COUNTER_TYPE ulLatency = 0UL, ulScaled;
+				UBaseType_t uxBucket = 0U;
+
+					if( ulTotalRunTime > pxCurrentTCB->ulReadyTime )
+					{
+						ulLatency = ulTotalRunTime - pxCurrentTCB->ulReadyTime;
+					}
+
+					ulScaled = ulLatency >> configRUN_TIME_STATS_LATENCY_SHIFT;
+					while( ( ulScaled != 0UL ) && ( uxBucket < ( UBaseType_t ) ( configRUN_TIME_STATS_LATENCY_BUCKETS - 1 ) ) )
+					{
+						ulScaled >>= 1;
+						uxBucket++;
+					}
+
+					( pxCurrentTCB->ulLatencyHistogram[ uxBucket ] )++;
+					if( ulLatency > pxCurrentTCB->ulMaxLatency )
+					{
+						pxCurrentTCB->ulMaxLatency = ulLatency;
+					}
+
+					pxCurrentTCB->ulReadyTime = 0UL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
 		/* After the new task is switched in, update the global errno. */
 		#if( configUSE_POSIX_ERRNO == 1 )
 		{
@@ -3552,8 +3947,8 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	taskDELAYED_LIST_INITIALISE( &xDelayedTaskList1 );
+	taskDELAYED_LIST_INITIALISE( &xDelayedTaskList2 );
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3700,25 +4095,21 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configGENERATE_RUN_TIME_STATS == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) )
 
-	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState )
+	static UBaseType_t prvForEachTaskWithinSingleList( List_t *pxList, eTaskState eState, TaskVisitor_t pxVisitor, void *pvContext, UBaseType_t uxIndex )
 	{
 	configLIST_VOLATILE TCB_t *pxNextTCB, *pxFirstTCB;
-	UBaseType_t uxTask = 0;
+	UBaseType_t uxTask = uxIndex;
 
 		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
 		{
 			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-			/* Populate an TaskStatus_t structure within the
-			pxTaskStatusArray array for each task that is referenced from
-			pxList.  See the definition of TaskStatus_t in task.h for the
-			meaning of each TaskStatus_t structure member. */
 			do
 			{
 				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+				pxVisitor( ( TCB_t * ) pxNextTCB, eState, uxTask, pvContext );
 				uxTask++;
 			} while( pxNextTCB != pxFirstTCB );
 		}
@@ -3729,11 +4120,105 @@ static void prvCheckTasksWaitingTermination( void )
 
 		return uxTask;
 	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvForEachTask( TaskVisitor_t pxVisitor, void *pvContext )
+	{
+	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+		do
+		{
+			uxQueue--;
+			uxTask = prvForEachTaskWithinSingleList( &( pxReadyTasksLists[ uxQueue ] ), eReady, pxVisitor, pvContext, uxTask );
+
+		} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+		#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+		{
+		UBaseType_t uxBucket;
+
+			for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) configTIMING_WHEEL_SIZE; uxBucket++ )
+			{
+				uxTask = prvForEachTaskWithinSingleList( &( pxDelayedTaskList->xBuckets[ uxBucket ] ), eBlocked, pxVisitor, pvContext, uxTask );
+				uxTask = prvForEachTaskWithinSingleList( &( pxOverflowDelayedTaskList->xBuckets[ uxBucket ] ), eBlocked, pxVisitor, pvContext, uxTask );
+			}
+		}
+		#else
+		{
+			uxTask = prvForEachTaskWithinSingleList( ( List_t * ) pxDelayedTaskList, eBlocked, pxVisitor, pvContext, uxTask );
+			uxTask = prvForEachTaskWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, eBlocked, pxVisitor, pvContext, uxTask );
+		}
+		#endif
+
+		#if( INCLUDE_vTaskDelete == 1 )
+		{
+			uxTask = prvForEachTaskWithinSingleList( &xTasksWaitingTermination, eDeleted, pxVisitor, pvContext, uxTask );
+		}
+		#endif
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+		{
+			uxTask = prvForEachTaskWithinSingleList( &xSuspendedTaskList, eSuspended, pxVisitor, pvContext, uxTask );
+		}
+		#endif
+
+		return uxTask;
+	}
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( configGENERATE_RUN_TIME_STATS == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	static void prvGetTaskStatus( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext )
+	{
+	TaskStatus_t *pxTaskStatusArray = ( TaskStatus_t * ) pvContext;
+
+		vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxIndex ] ), pdTRUE, eState );
+	}
 
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	static configRUN_TIME_COUNTER_TYPE prvGetRunTimeCounterValue( void )
+	{
+	configRUN_TIME_COUNTER_TYPE ulCounterValue;
+
+		#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulCounterValue );
+		#else
+			ulCounterValue = portGET_RUN_TIME_COUNTER_VALUE();
+		#endif
+
+		return ulCounterValue;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvGetRunTimeStats( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext )
+	{
+	TaskRunTimeStats_t *pxStats = &( ( ( TaskRunTimeStats_t * ) pvContext )[ uxIndex ] );
+
+		( void ) eState;
+
+		pxStats->xHandle = ( TaskHandle_t ) pxTCB;
+		pxStats->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
+		pxStats->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+		pxStats->ulMaxLatency = pxTCB->ulMaxLatency;
+		pxStats->ulSwitchCount = pxTCB->ulSwitchCount;
+		( void ) memcpy( ( void * ) pxStats->ulLatencyHistogram, ( const void * ) pxTCB->ulLatencyHistogram, sizeof( pxTCB->ulLatencyHistogram ) );
+		#if( configUSE_TASK_FPU_CONTROL == 1 )
+		{
+			pxStats->ulFPUSwitchCount = pxTCB->ulFPUSwitchCount;
+		}
+		#endif
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) )
 
 	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
 	{
@@ -3750,7 +4235,7 @@ static void prvCheckTasksWaitingTermination( void )
 		return ( configSTACK_DEPTH_TYPE ) ulCount;
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( INCLUDE_uxTaskGetStackStats == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
@@ -3821,6 +4306,107 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
+#if ( INCLUDE_uxTaskGetStackStats == 1 )
+
+	static void prvFillStackStats( TCB_t *pxTCB, TaskStackStats_t *pxStats )
+	{
+		pxStats->xHandle = ( TaskHandle_t ) pxTCB;
+		pxStats->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
+		pxStats->pxStackBase = pxTCB->pxStack;
+		pxStats->usStackDepth = ( configSTACK_DEPTH_TYPE ) ( ( pxTCB->pxEndOfStack - pxTCB->pxStack ) + 1 );
+
+		#if ( portSTACK_GROWTH > 0 )
+		{
+			pxStats->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+		}
+		#else
+		{
+			pxStats->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+		}
+		#endif
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvGetStackStats( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext )
+	{
+		( void ) eState;
+
+		prvFillStackStats( pxTCB, &( ( ( TaskStackStats_t * ) pvContext )[ uxIndex ] ) );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvGetStackStatsAtIndex( TCB_t *pxTCB, eTaskState eState, UBaseType_t uxIndex, void *pvContext )
+	{
+	StackStatsQuery_t *pxQuery = ( StackStatsQuery_t * ) pvContext;
+
+		( void ) eState;
+
+		/* Only the selected stack is checked, the other tasks are just
+		counted. */
+		if( uxIndex == pxQuery->uxIndex )
+		{
+			prvFillStackStats( pxTCB, pxQuery->pxStats );
+			pxQuery->xFound = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskGetStackStats( TaskStackStats_t * const pxStatsArray, const UBaseType_t uxArraySize )
+	{
+	UBaseType_t uxTask = 0;
+
+		#if( ( portSTACK_GROWTH < 0 ) && ( configRECORD_STACK_HIGH_ADDRESS != 1 ) )
+		{
+			#error configRECORD_STACK_HIGH_ADDRESS must also be set to 1 in FreeRTOSConfig.h to use uxTaskGetStackStats().
+		}
+		#endif
+
+		vTaskSuspendAll();
+		{
+			/* Is there a space in the array for each task in the system? */
+			if( uxArraySize >= uxCurrentNumberOfTasks )
+			{
+				/* Tasks are visited in the same order as by
+				uxTaskGetSystemState(). */
+				uxTask = prvForEachTask( prvGetStackStats, ( void * ) pxStatsArray );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return uxTask;
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskGetStackStatsByIndex( UBaseType_t uxIndex, TaskStackStats_t * const pxStats )
+	{
+	StackStatsQuery_t xQuery;
+
+		configASSERT( pxStats );
+
+		xQuery.uxIndex = uxIndex;
+		xQuery.pxStats = pxStats;
+		xQuery.xFound = pdFALSE;
+
+		vTaskSuspendAll();
+		{
+			( void ) prvForEachTask( prvGetStackStatsAtIndex, ( void * ) &xQuery );
+		}
+		( void ) xTaskResumeAll();
+
+		return ( xQuery.xFound != pdFALSE ) ? pdPASS : pdFAIL;
+	}
+
+#endif /* INCLUDE_uxTaskGetStackStats */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
 	static void prvDeleteTCB( TCB_t *pxTCB )
@@ -3879,6 +4465,22 @@ static void prvCheckTasksWaitingTermination( void )
 
 static void prvResetNextTaskUnblockTime( void )
 {
+#if( configUSE_DELAYED_LIST_TIMING_WHEEL == 1 )
+const ListItem_t *pxEarliest;
+
+	/* No task in the current wheel can have a wake time earlier than the
+	current tick count, so the search can start from there. */
+	pxEarliest = pxTimingWheelGetEarliest( pxDelayedTaskList, xTickCount );
+
+	if( pxEarliest == NULL )
+	{
+		xNextTaskUnblockTime = portMAX_DELAY;
+	}
+	else
+	{
+		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( pxEarliest );
+	}
+#else
 TCB_t *pxTCB;
 
 	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
@@ -3898,6 +4500,7 @@ TCB_t *pxTCB;
 		( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
 	}
+#endif /* configUSE_DELAYED_LIST_TIMING_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -4409,7 +5012,7 @@ TCB_t *pxTCB;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
+	configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
 
 		#if( configUSE_TRACE_FACILITY != 1 )
 		{
@@ -4482,7 +5085,7 @@ TCB_t *pxTCB;
 					{
 						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned long ) ulStatsAsPercentage );
 						}
 						#else
 						{
@@ -4498,7 +5101,7 @@ TCB_t *pxTCB;
 						consumed less than 1% of the total run time. */
 						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
+							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter );
 						}
 						#else
 						{
@@ -4567,16 +5170,18 @@ TickType_t uxReturn;
 	{
 	uint32_t ulReturn;
 
-		taskENTER_CRITICAL();
+		/* The task can only block if a timeout is given. Without it the
+		notification is just taken in the critical section below, which halves
+		the cost of polling the notification. */
+		if( xTicksToWait > ( TickType_t ) 0 )
 		{
-			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			taskENTER_CRITICAL();
 			{
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
-
-				if( xTicksToWait > ( TickType_t ) 0 )
+				/* Only block if the notification count is not already non-zero. */
+				if( pxCurrentTCB->ulNotifiedValue == 0UL )
 				{
+					/* Mark this task as waiting for a notification. */
+					pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
 					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 					traceTASK_NOTIFY_TAKE_BLOCK();
 
@@ -4591,12 +5196,12 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		taskEXIT_CRITICAL();
 
 		taskENTER_CRITICAL();
 		{
@@ -4635,41 +5240,50 @@ TickType_t uxReturn;
 	{
 	BaseType_t xReturn;
 
-		taskENTER_CRITICAL();
+		/* Nothing has to be done before taking the notification if the task is
+		not going to block and no bits are cleared on entry. */
+		if( ( xTicksToWait > ( TickType_t ) 0 ) || ( ulBitsToClearOnEntry != 0UL ) )
 		{
-			/* Only block if a notification is not already pending. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			taskENTER_CRITICAL();
 			{
-				/* Clear bits in the task's notification value as bits may get
-				set	by the notifying task or interrupt.  This can be used to
-				clear the value to zero. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
-
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
-
-				if( xTicksToWait > ( TickType_t ) 0 )
+				/* Only block if a notification is not already pending. */
+				if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
 				{
-					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-					traceTASK_NOTIFY_WAIT_BLOCK();
+					/* Clear bits in the task's notification value as bits may get
+					set	by the notifying task or interrupt.  This can be used to
+					clear the value to zero. */
+					pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
 
-					/* All ports are written to allow a yield in a critical
-					section (some will yield immediately, others wait until the
-					critical section exits) - but it is not something that
-					application code should ever do. */
-					portYIELD_WITHIN_API();
+					/* Mark this task as waiting for a notification. */
+					pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+
+					if( xTicksToWait > ( TickType_t ) 0 )
+					{
+						prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+						traceTASK_NOTIFY_WAIT_BLOCK();
+
+						/* All ports are written to allow a yield in a critical
+						section (some will yield immediately, others wait until the
+						critical section exits) - but it is not something that
+						application code should ever do. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		taskEXIT_CRITICAL();
 
 		taskENTER_CRITICAL();
 		{
@@ -5071,7 +5685,7 @@ TickType_t uxReturn;
 /*-----------------------------------------------------------*/
 
 #if( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
-	TickType_t xTaskGetIdleRunTimeCounter( void )
+	configRUN_TIME_COUNTER_TYPE xTaskGetIdleRunTimeCounter( void )
 	{
 		return xIdleTaskHandle->ulRunTimeCounter;
 	}
@@ -5128,13 +5742,13 @@ const TickType_t xConstTickCount = xTickCount;
 			{
 				/* Wake time has overflowed.  Place this item in the overflow
 				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				taskDELAYED_LIST_INSERT( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
 				/* The wake time has not overflowed, so the current block list
 				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				taskDELAYED_LIST_INSERT( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
 				/* If the task entering the blocked state was placed at the
 				head of the list of blocked tasks then xNextTaskUnblockTime
@@ -5163,12 +5777,12 @@ const TickType_t xConstTickCount = xTickCount;
 		if( xTimeToWake < xConstTickCount )
 		{
 			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			taskDELAYED_LIST_INSERT( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 		}
 		else
 		{
 			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			taskDELAYED_LIST_INSERT( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
 			/* If the task entering the blocked state was placed at the head of the
 			list of blocked tasks then xNextTaskUnblockTime needs to be updated
@@ -38,6 +38,10 @@ task.h is included from an application file. */
 #include "queue.h"
 #include "timers.h"
 
+#if ( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	#include "timing_wheel.h"
+#endif
+
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
@@ -80,6 +84,11 @@ typedef struct tmrTimerControl /* The old naming convention is used to prevent b
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+		struct tmrTimerHeap	*pxTimerHeap;		/*<< The heap of active timers that holds the timer, or NULL if the timer is not in any heap. */
+		UBaseType_t			uxHeapIndex;		/*<< Position of the timer in the heap. */
+		UBaseType_t			uxHeapSequence;		/*<< Insertion order, keeps timers with equal expiry time in the same order as the sorted list does. */
+	#endif
 	uint8_t 				ucStatus;			/*<< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
 } xTIMER;
 
@@ -123,6 +132,37 @@ typedef struct tmrTimerQueueMessage
 	} u;
 } DaemonTaskMessage_t;
 
+/* The structure that holds the active timers.  By default it is a list sorted
+by the expiry time, so starting a timer takes time proportional to the number of
+active timers.  Setting configUSE_TIMER_LIST_HEAP to 1 stores the timers in a
+binary heap instead (logarithmic time, up to configTIMER_HEAP_LENGTH timers),
+and setting configUSE_TIMER_LIST_TIMING_WHEEL to 1 stores them in a timing
+wheel (see timing_wheel.h): starting a timer takes constant time and finding
+the nearest expiry time visits at most the configTIMING_WHEEL_SIZE buckets,
+regardless of the number of active timers.  The expiry order is the same for
+all of them.  The heaps belong to the timer service task, so a timer that does
+not fit into its heap when the command starting it is processed is left
+dormant (xTimerIsTimerActive() returns pdFALSE). */
+#if( configUSE_TIMER_LIST_HEAP == 1 )
+
+	typedef struct tmrTimerHeap
+	{
+		UBaseType_t			uxNumberOfTimers;						/*<< Number of timers in the heap. */
+		Timer_t *			pxTimers[ configTIMER_HEAP_LENGTH ];	/*<< The timer with the nearest expiry time is always at index 0. */
+	} TimerHeap_t;
+
+	typedef TimerHeap_t ActiveTimerList_t;
+
+#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+
+	typedef TimingWheel_t ActiveTimerList_t;
+
+#else
+
+	typedef List_t ActiveTimerList_t;
+
+#endif
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
@@ -132,10 +172,23 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+PRIVILEGED_DATA static ActiveTimerList_t xActiveTimerList1;
+PRIVILEGED_DATA static ActiveTimerList_t xActiveTimerList2;
+PRIVILEGED_DATA static ActiveTimerList_t *pxCurrentTimerList;
+PRIVILEGED_DATA static ActiveTimerList_t *pxOverflowTimerList;
+
+#if( configUSE_TIMER_LIST_HEAP == 1 )
+
+	/* Incremented each time a timer is inserted into a heap. */
+	PRIVILEGED_DATA static UBaseType_t uxTimerHeapSequence = ( UBaseType_t ) 0U;
+
+#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+
+	/* No timer in the current timing wheel expires earlier than this time, so
+	searching for the nearest expiry time can start from here. */
+	PRIVILEGED_DATA static TickType_t xCurrentTimerListLowerBound = ( TickType_t ) 0U;
+
+#endif
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -222,6 +275,27 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 									void * const pvTimerID,
 									TimerCallbackFunction_t pxCallbackFunction,
 									Timer_t *pxNewTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Operations on the active timer lists, implemented for each of the structures
+ * selectable with configUSE_TIMER_LIST_HEAP and configUSE_TIMER_LIST_TIMING_WHEEL.
+ * The expiry time of the timer must be set in its list item before insertion.
+ * prvActiveTimerListInsert() returns pdFAIL if the list is full (only possible
+ * with the heap), otherwise pdPASS.  prvActiveTimerListGetHead() returns the
+ * timer with the nearest expiry time, or NULL if the list is empty.
+ */
+static void prvActiveTimerListInitialise( ActiveTimerList_t * const pxList ) PRIVILEGED_FUNCTION;
+static BaseType_t prvActiveTimerListInsert( ActiveTimerList_t * const pxList, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+static void prvActiveTimerListRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+static BaseType_t prvActiveTimerListIsEmpty( ActiveTimerList_t * const pxList ) PRIVILEGED_FUNCTION;
+static Timer_t *prvActiveTimerListGetHead( ActiveTimerList_t * const pxList ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsTimerInActiveList( const Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Inserts the timer into the active list.  If the list is full the timer is
+ * marked as not active, so it is left dormant until it is started again.
+ */
+static void prvInsertTimerOrDeactivate( ActiveTimerList_t * const pxList, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -369,6 +443,11 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 		pxNewTimer->pvTimerID = pvTimerID;
 		pxNewTimer->pxCallbackFunction = pxCallbackFunction;
 		vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+		#if( configUSE_TIMER_LIST_HEAP == 1 )
+		{
+			pxNewTimer->pxTimerHeap = NULL;
+		}
+		#endif
 		if( uxAutoReload != pdFALSE )
 		{
 			pxNewTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
@@ -482,11 +561,11 @@ Timer_t *pxTimer = xTimer;
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+Timer_t * const pxTimer = prvActiveTimerListGetHead( pxCurrentTimerList );
 
 	/* Remove the timer from the list of active timers.  A check has already
 	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+	prvActiveTimerListRemove( pxTimer );
 	traceTIMER_EXPIRED( pxTimer );
 
 	/* If the timer is an auto reload timer then calculate the next
@@ -589,7 +668,7 @@ BaseType_t xTimerListsWereSwitched;
 				{
 					/* The current timer list is empty - is the overflow list
 					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					xListWasEmpty = prvActiveTimerListIsEmpty( pxOverflowTimerList );
 				}
 
 				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
@@ -619,6 +698,7 @@ BaseType_t xTimerListsWereSwitched;
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
+const Timer_t * const pxHeadTimer = prvActiveTimerListGetHead( pxCurrentTimerList );
 
 	/* Timers are listed in expiry time order, with the head of the list
 	referencing the task that will expire first.  Obtain the time at which
@@ -627,14 +707,15 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	if( pxHeadTimer != NULL )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		*pxListWasEmpty = pdFALSE;
+		xNextExpireTime = listGET_LIST_ITEM_VALUE( &( pxHeadTimer->xTimerListItem ) );
 	}
 	else
 	{
 		/* Ensure the task unblocks when the tick count rolls over. */
+		*pxListWasEmpty = pdTRUE;
 		xNextExpireTime = ( TickType_t ) 0U;
 	}
 
@@ -684,7 +765,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			prvInsertTimerOrDeactivate( pxOverflowTimerList, pxTimer );
 		}
 	}
 	else
@@ -698,7 +779,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			prvInsertTimerOrDeactivate( pxCurrentTimerList, pxTimer );
 		}
 	}
 
@@ -745,10 +826,10 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+			if( prvIsTimerInActiveList( pxTimer ) != pdFALSE )
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvActiveTimerListRemove( pxTimer );
 			}
 			else
 			{
@@ -857,7 +938,7 @@ TickType_t xTimeNow;
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
+ActiveTimerList_t *pxTemp;
 Timer_t *pxTimer;
 BaseType_t xResult;
 
@@ -865,13 +946,13 @@ BaseType_t xResult;
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
 	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	while( prvActiveTimerListIsEmpty( pxCurrentTimerList ) == pdFALSE )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		pxTimer = prvActiveTimerListGetHead( pxCurrentTimerList );
+		xNextExpireTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
 
 		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		prvActiveTimerListRemove( pxTimer );
 		traceTIMER_EXPIRED( pxTimer );
 
 		/* Execute its callback, then send a command to restart the timer if
@@ -892,7 +973,7 @@ BaseType_t xResult;
 			{
 				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
 				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				prvInsertTimerOrDeactivate( pxCurrentTimerList, pxTimer );
 			}
 			else
 			{
@@ -910,6 +991,14 @@ BaseType_t xResult;
 	pxTemp = pxCurrentTimerList;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
+
+	#if( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	{
+		/* The expiry times in the new current wheel have overflowed, so they
+		can be anywhere from 0. */
+		xCurrentTimerListLowerBound = ( TickType_t ) 0U;
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -922,8 +1011,8 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
+			prvActiveTimerListInitialise( &xActiveTimerList1 );
+			prvActiveTimerListInitialise( &xActiveTimerList2 );
 			pxCurrentTimerList = &xActiveTimerList1;
 			pxOverflowTimerList = &xActiveTimerList2;
 
@@ -964,6 +1053,290 @@ static void prvCheckForValidListAndQueue( void )
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_LIST_HEAP == 1 )
+
+	static BaseType_t prvTimerHeapIsEarlier( const Timer_t * const pxTimer, const Timer_t * const pxOtherTimer )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+	const TickType_t xOtherExpiryTime = listGET_LIST_ITEM_VALUE( &( pxOtherTimer->xTimerListItem ) );
+	BaseType_t xReturn;
+
+		if( xExpiryTime != xOtherExpiryTime )
+		{
+			xReturn = ( xExpiryTime < xOtherExpiryTime ) ? pdTRUE : pdFALSE;
+		}
+		else
+		{
+			/* Timers with the same expiry time are kept in the insertion
+			order.  The difference is used, so the sequence can overflow. */
+			xReturn = ( ( BaseType_t ) ( pxTimer->uxHeapSequence - pxOtherTimer->uxHeapSequence ) < ( BaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTimerHeapPlace( TimerHeap_t * const pxHeap, Timer_t * const pxTimer, UBaseType_t uxIndex )
+	{
+		pxHeap->pxTimers[ uxIndex ] = pxTimer;
+		pxTimer->uxHeapIndex = uxIndex;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTimerHeapSiftUp( TimerHeap_t * const pxHeap, UBaseType_t uxIndex )
+	{
+	Timer_t * const pxTimer = pxHeap->pxTimers[ uxIndex ];
+	UBaseType_t uxParent;
+
+		while( uxIndex > ( UBaseType_t ) 0U )
+		{
+			uxParent = ( uxIndex - ( UBaseType_t ) 1U ) / ( UBaseType_t ) 2U;
+			if( prvTimerHeapIsEarlier( pxTimer, pxHeap->pxTimers[ uxParent ] ) == pdFALSE )
+			{
+				break;
+			}
+
+			prvTimerHeapPlace( pxHeap, pxHeap->pxTimers[ uxParent ], uxIndex );
+			uxIndex = uxParent;
+		}
+
+		prvTimerHeapPlace( pxHeap, pxTimer, uxIndex );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTimerHeapSiftDown( TimerHeap_t * const pxHeap, UBaseType_t uxIndex )
+	{
+	Timer_t * const pxTimer = pxHeap->pxTimers[ uxIndex ];
+	UBaseType_t uxChild;
+
+		for( ;; )
+		{
+			uxChild = ( uxIndex * ( UBaseType_t ) 2U ) + ( UBaseType_t ) 1U;
+			if( uxChild >= pxHeap->uxNumberOfTimers )
+			{
+				break;
+			}
+
+			/* Select the earlier of the two children. */
+			if( ( ( uxChild + ( UBaseType_t ) 1U ) < pxHeap->uxNumberOfTimers ) &&
+				( prvTimerHeapIsEarlier( pxHeap->pxTimers[ uxChild + ( UBaseType_t ) 1U ], pxHeap->pxTimers[ uxChild ] ) != pdFALSE ) )
+			{
+				uxChild++;
+			}
+
+			if( prvTimerHeapIsEarlier( pxHeap->pxTimers[ uxChild ], pxTimer ) == pdFALSE )
+			{
+				break;
+			}
+
+			prvTimerHeapPlace( pxHeap, pxHeap->pxTimers[ uxChild ], uxIndex );
+			uxIndex = uxChild;
+		}
+
+		prvTimerHeapPlace( pxHeap, pxTimer, uxIndex );
+	}
+
+#endif /* configUSE_TIMER_LIST_HEAP */
+/*-----------------------------------------------------------*/
+
+static void prvActiveTimerListInitialise( ActiveTimerList_t * const pxList )
+{
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+		pxList->uxNumberOfTimers = ( UBaseType_t ) 0U;
+	}
+	#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	{
+		vTimingWheelInitialise( pxList );
+	}
+	#else
+	{
+		vListInitialise( pxList );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvActiveTimerListInsert( ActiveTimerList_t * const pxList, Timer_t * const pxTimer )
+{
+BaseType_t xReturn = pdPASS;
+
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+		/* The heap cannot grow, increase configTIMER_HEAP_LENGTH if timers
+		are rejected. */
+		if( pxList->uxNumberOfTimers < ( UBaseType_t ) configTIMER_HEAP_LENGTH )
+		{
+			pxTimer->pxTimerHeap = pxList;
+			pxTimer->uxHeapSequence = uxTimerHeapSequence;
+			uxTimerHeapSequence++;
+
+			prvTimerHeapPlace( pxList, pxTimer, pxList->uxNumberOfTimers );
+			( pxList->uxNumberOfTimers )++;
+			prvTimerHeapSiftUp( pxList, pxTimer->uxHeapIndex );
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	{
+		vTimingWheelInsert( pxList, &( pxTimer->xTimerListItem ) );
+
+		if( ( pxList == pxCurrentTimerList ) && ( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) < xCurrentTimerListLowerBound ) )
+		{
+			xCurrentTimerListLowerBound = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		vListInsert( pxList, &( pxTimer->xTimerListItem ) );
+	}
+	#endif
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvActiveTimerListRemove( Timer_t * const pxTimer )
+{
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+	TimerHeap_t * const pxHeap = pxTimer->pxTimerHeap;
+	const UBaseType_t uxIndex = pxTimer->uxHeapIndex;
+	Timer_t *pxLastTimer;
+
+		( pxHeap->uxNumberOfTimers )--;
+
+		/* Fill the gap with the last timer and move it up or down to restore
+		the heap order. */
+		if( uxIndex != pxHeap->uxNumberOfTimers )
+		{
+			pxLastTimer = pxHeap->pxTimers[ pxHeap->uxNumberOfTimers ];
+			prvTimerHeapPlace( pxHeap, pxLastTimer, uxIndex );
+			prvTimerHeapSiftUp( pxHeap, uxIndex );
+			prvTimerHeapSiftDown( pxHeap, pxLastTimer->uxHeapIndex );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxTimer->pxTimerHeap = NULL;
+	}
+	#else
+	{
+		/* Buckets of the timing wheel are regular lists. */
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvActiveTimerListIsEmpty( ActiveTimerList_t * const pxList )
+{
+BaseType_t xReturn;
+
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+		xReturn = ( pxList->uxNumberOfTimers == ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+	}
+	#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	{
+		xReturn = xTimingWheelIsEmpty( pxList );
+	}
+	#else
+	{
+		xReturn = listLIST_IS_EMPTY( pxList );
+	}
+	#endif
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static Timer_t *prvActiveTimerListGetHead( ActiveTimerList_t * const pxList )
+{
+Timer_t *pxTimer;
+
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+		pxTimer = ( pxList->uxNumberOfTimers == ( UBaseType_t ) 0U ) ? NULL : pxList->pxTimers[ 0 ];
+	}
+	#elif( configUSE_TIMER_LIST_TIMING_WHEEL == 1 )
+	{
+	const ListItem_t *pxEarliest;
+
+		/* Only the current list is ordered by the lower bound. */
+		configASSERT( pxList == pxCurrentTimerList );
+
+		pxEarliest = pxTimingWheelGetEarliest( pxList, xCurrentTimerListLowerBound );
+		if( pxEarliest != NULL )
+		{
+			/* The search for the next timer can start from here. */
+			xCurrentTimerListLowerBound = listGET_LIST_ITEM_VALUE( pxEarliest );
+			pxTimer = ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxEarliest ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		else
+		{
+			pxTimer = NULL;
+		}
+	}
+	#else
+	{
+		if( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		else
+		{
+			pxTimer = NULL;
+		}
+	}
+	#endif
+
+	return pxTimer;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsTimerInActiveList( const Timer_t * const pxTimer )
+{
+BaseType_t xReturn;
+
+	#if( configUSE_TIMER_LIST_HEAP == 1 )
+	{
+		xReturn = ( pxTimer->pxTimerHeap != NULL ) ? pdTRUE : pdFALSE;
+	}
+	#else
+	{
+		xReturn = ( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) ? pdTRUE : pdFALSE; /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+	}
+	#endif
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertTimerOrDeactivate( ActiveTimerList_t * const pxList, Timer_t * const pxTimer )
+{
+	if( prvActiveTimerListInsert( pxList, pxTimer ) == pdFAIL )
+	{
+		/* The heap cannot grow, increase configTIMER_HEAP_LENGTH if this
+		happens. */
+		pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer )
 {
 BaseType_t xReturn;
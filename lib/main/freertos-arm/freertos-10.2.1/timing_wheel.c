@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timing_wheel.h"
+
+/* The most significant bit lookup of the ready priorities bitmap is reused to
+find the occupied buckets. */
+#include "priority_bitmap.h"
+
+#define wheelBUCKET_INDEX( xTick )	( ( UBaseType_t ) ( ( xTick ) & ( ( TickType_t ) configTIMING_WHEEL_SIZE - ( TickType_t ) 1 ) ) )
+
+/* Buckets are mapped to the bits of the occupancy bitmap starting from the
+most significant one, so the first occupied bucket at or after a given one is
+the most significant set bit of the masked word. */
+#define wheelBUCKET_BIT( uxBucket )	( ( uint32_t ) 0x80000000UL >> ( ( uxBucket ) % wheelBITS_PER_WORD ) )
+
+/*
+ * Returns the index of the first bucket from the range [uxFirst, uxEnd) which
+ * holds any items, or uxEnd if all of them are empty.  Clears the bits of the
+ * visited buckets whose items have been removed with uxListRemove().
+ */
+static UBaseType_t prvGetOccupiedBucket( TimingWheel_t * const pxWheel, UBaseType_t uxFirst, UBaseType_t uxEnd ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+ * PUBLIC TIMING WHEEL API documented in timing_wheel.h
+ *----------------------------------------------------------*/
+
+void vTimingWheelInitialise( TimingWheel_t * const pxWheel )
+{
+UBaseType_t uxBucket;
+UBaseType_t uxWord;
+
+	for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) configTIMING_WHEEL_SIZE; uxBucket++ )
+	{
+		vListInitialise( &( pxWheel->xBuckets[ uxBucket ] ) );
+	}
+
+	for( uxWord = ( UBaseType_t ) 0U; uxWord < ( UBaseType_t ) wheelWORD_COUNT; uxWord++ )
+	{
+		pxWheel->ulOccupied[ uxWord ] = 0UL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTimingWheelInsert( TimingWheel_t * const pxWheel, ListItem_t * const pxNewListItem )
+{
+const TickType_t xValueOfInsertion = listGET_LIST_ITEM_VALUE( pxNewListItem );
+const UBaseType_t uxBucket = wheelBUCKET_INDEX( xValueOfInsertion );
+List_t * const pxBucket = &( pxWheel->xBuckets[ uxBucket ] );
+
+	/* Items are usually inserted in the order of their value, so check the
+	last item of the bucket before walking the bucket from its head. */
+	if( ( listLIST_IS_EMPTY( pxBucket ) != pdFALSE ) || ( xValueOfInsertion >= listGET_LIST_ITEM_VALUE( pxBucket->xListEnd.pxPrevious ) ) )
+	{
+		vListInsertEnd( pxBucket, pxNewListItem );
+	}
+	else
+	{
+		vListInsert( pxBucket, pxNewListItem );
+	}
+
+	pxWheel->ulOccupied[ uxBucket / wheelBITS_PER_WORD ] |= wheelBUCKET_BIT( uxBucket );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimingWheelIsEmpty( TimingWheel_t * const pxWheel )
+{
+BaseType_t xReturn;
+
+	if( prvGetOccupiedBucket( pxWheel, ( UBaseType_t ) 0U, ( UBaseType_t ) configTIMING_WHEEL_SIZE ) == ( UBaseType_t ) configTIMING_WHEEL_SIZE )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimingWheelContainsList( const TimingWheel_t * const pxWheel, const List_t * const pxList )
+{
+BaseType_t xReturn;
+
+	if( ( pxList >= &( pxWheel->xBuckets[ 0 ] ) ) && ( pxList < &( pxWheel->xBuckets[ configTIMING_WHEEL_SIZE ] ) ) )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+ListItem_t * pxTimingWheelGetEarliest( TimingWheel_t * const pxWheel, TickType_t xFrom )
+{
+ListItem_t *pxEarliest = NULL;
+ListItem_t *pxHead;
+const UBaseType_t uxStart = wheelBUCKET_INDEX( xFrom );
+UBaseType_t uxFirst = uxStart;
+UBaseType_t uxEnd = ( UBaseType_t ) configTIMING_WHEEL_SIZE;
+UBaseType_t uxBucket;
+UBaseType_t uxPass;
+
+	/* The buckets are visited in the order of ticks starting at xFrom, which
+	takes two passes: from the bucket of xFrom to the end of the wheel and from
+	the beginning of the wheel to the bucket of xFrom. */
+	for( uxPass = ( UBaseType_t ) 0U; uxPass < ( UBaseType_t ) 2U; uxPass++ )
+	{
+		for( uxBucket = prvGetOccupiedBucket( pxWheel, uxFirst, uxEnd ); uxBucket < uxEnd; uxBucket = prvGetOccupiedBucket( pxWheel, uxBucket + ( UBaseType_t ) 1U, uxEnd ) )
+		{
+			/* Buckets are sorted, so the head is the earliest item. */
+			pxHead = listGET_HEAD_ENTRY( &( pxWheel->xBuckets[ uxBucket ] ) );
+
+			if( ( listGET_LIST_ITEM_VALUE( pxHead ) - xFrom ) < ( TickType_t ) configTIMING_WHEEL_SIZE )
+			{
+				/* No item can expire earlier than the tick of the bucket
+				being visited, as all earlier ticks have been visited. */
+				return pxHead;
+			}
+
+			/* The bucket holds only items of later turns of the wheel. */
+			if( ( pxEarliest == NULL ) || ( listGET_LIST_ITEM_VALUE( pxHead ) < listGET_LIST_ITEM_VALUE( pxEarliest ) ) )
+			{
+				pxEarliest = pxHead;
+			}
+		}
+
+		uxFirst = ( UBaseType_t ) 0U;
+		uxEnd = uxStart;
+	}
+
+	return pxEarliest;
+}
+/*-----------------------------------------------------------*/
+
+void vTimingWheelCollectExpired( TimingWheel_t * const pxWheel, TickType_t xFrom, TickType_t xNow, List_t * const pxExpiredList )
+{
+ListItem_t *pxHead;
+List_t *pxBucket;
+TickType_t xTick = xFrom;
+UBaseType_t uxBucket;
+UBaseType_t uxBucketsToVisit;
+
+	configASSERT( xFrom <= xNow );
+
+	/* If more ticks than buckets have passed, every bucket has to be
+	visited exactly once. */
+	if( ( xNow - xFrom ) >= ( TickType_t ) configTIMING_WHEEL_SIZE )
+	{
+		uxBucketsToVisit = ( UBaseType_t ) configTIMING_WHEEL_SIZE;
+	}
+	else
+	{
+		uxBucketsToVisit = ( UBaseType_t ) ( xNow - xFrom ) + ( UBaseType_t ) 1U;
+	}
+
+	while( uxBucketsToVisit > ( UBaseType_t ) 0U )
+	{
+		uxBucket = wheelBUCKET_INDEX( xTick );
+		pxBucket = &( pxWheel->xBuckets[ uxBucket ] );
+
+		/* Buckets are sorted, so the expired items are at the head. */
+		while( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+		{
+			pxHead = listGET_HEAD_ENTRY( pxBucket );
+
+			if( listGET_LIST_ITEM_VALUE( pxHead ) > xNow )
+			{
+				break;
+			}
+
+			( void ) uxListRemove( pxHead );
+			vListInsert( pxExpiredList, pxHead );
+		}
+
+		if( listLIST_IS_EMPTY( pxBucket ) != pdFALSE )
+		{
+			pxWheel->ulOccupied[ uxBucket / wheelBITS_PER_WORD ] &= ~wheelBUCKET_BIT( uxBucket );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xTick++;
+		uxBucketsToVisit--;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetOccupiedBucket( TimingWheel_t * const pxWheel, UBaseType_t uxFirst, UBaseType_t uxEnd )
+{
+UBaseType_t uxOccupied = uxEnd;
+UBaseType_t uxBucket = uxFirst;
+UBaseType_t uxWord;
+uint32_t ulBits;
+
+	while( uxBucket < uxEnd )
+	{
+		uxWord = uxBucket / wheelBITS_PER_WORD;
+		ulBits = pxWheel->ulOccupied[ uxWord ] & ( ( uint32_t ) 0xFFFFFFFFUL >> ( uxBucket % wheelBITS_PER_WORD ) );
+
+		if( ulBits == 0UL )
+		{
+			/* Skip to the first bucket of the next word. */
+			uxBucket = ( uxWord + ( UBaseType_t ) 1U ) * wheelBITS_PER_WORD;
+		}
+		else
+		{
+			uxBucket = ( uxWord * wheelBITS_PER_WORD ) + ( ( UBaseType_t ) 31U - uxPriorityBitmapFindMsb( ulBits ) );
+
+			if( uxBucket >= uxEnd )
+			{
+				/* The bucket is outside of the range, the loop ends. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else if( listLIST_IS_EMPTY( &( pxWheel->xBuckets[ uxBucket ] ) ) == pdFALSE )
+			{
+				uxOccupied = uxBucket;
+				break;
+			}
+			else
+			{
+				/* The last item of the bucket has been removed with
+				uxListRemove(), which does not update the bitmap. */
+				pxWheel->ulOccupied[ uxWord ] &= ~wheelBUCKET_BIT( uxBucket );
+				uxBucket++;
+			}
+		}
+	}
+
+	return uxOccupied;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder. */
+#if( configUSE_TRACE_RECORDER == 1 )
+
+/* Converts the object pointer to the identifier stored in the records.  Only
+the lower 32 bits are kept, which is enough to tell apart objects allocated
+within the same program. */
+#define traceOBJECT_ID( pvObject ) ( ( uint32_t ) ( uintptr_t ) ( pvObject ) )
+
+/* The header is initialised statically, so events are recorded from the very
+first task creation, before the scheduler is started. */
+TraceRecorder_t xTraceRecorder =
+{
+	{
+		traceRECORDER_MAGIC,
+		traceRECORDER_VERSION,
+		( uint16_t ) sizeof( TraceRecorderHeader_t ),
+		( uint16_t ) sizeof( TraceObject_t ),
+		( uint16_t ) sizeof( TraceRecord_t ),
+		configTRACE_RECORDER_MAX_OBJECTS,
+		configTRACE_RECORDER_BUFFER_LENGTH,
+		0U,
+		0U,
+		1U,
+		0U
+	},
+	{ { 0U, { 0 } } },
+	{ { 0U, 0U, 0U, 0U, 0U, 0U } }
+};
+
+/* Timestamps are stored relative to the first record written after the
+recorder was cleared (or since the start), so they take 48 bits only after
+that much time has been recorded and not after that much uptime. */
+static uint64_t ullTimestampBase = 0U;
+static BaseType_t xTimestampBaseSet = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	/* A single word is written, so the recorder can also be started and
+	stopped from ISRs (e.g. by a fault handler, to keep the events that led to
+	the fault). */
+	xTraceRecorder.xHeader.ulEnabled = 1U;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.xHeader.ulEnabled = 0U;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		( void ) memset( xTraceRecorder.xRecords, 0x00, sizeof( xTraceRecorder.xRecords ) );
+		xTraceRecorder.xHeader.ulHead = 0U;
+		xTimestampBaseSet = pdFALSE;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+const void *pvTraceRecorderGetData( size_t *pxSize )
+{
+	configASSERT( pxSize );
+
+	/* The frequency is normally set by the first record, but the host tools
+	need it also when nothing has been recorded yet. */
+	if( xTraceRecorder.xHeader.ullTimestampFrequency == 0U )
+	{
+		xTraceRecorder.xHeader.ullTimestampFrequency = ullTraceRecorderGetTimestampFrequency();
+	}
+
+	*pxSize = sizeof( xTraceRecorder );
+	return &xTraceRecorder;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderSetObjectName( const void *pvObject, const char *pcName )
+{
+UBaseType_t uxSavedInterruptStatus;
+TraceObject_t *pxEntry = NULL;
+uint32_t ulObject = traceOBJECT_ID( pvObject );
+uint32_t ulIndex;
+
+	configASSERT( pvObject );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* An object created at the address of a deleted one reuses its entry. */
+		for( ulIndex = 0U; ulIndex < ( uint32_t ) configTRACE_RECORDER_MAX_OBJECTS; ulIndex++ )
+		{
+			if( xTraceRecorder.xObjects[ ulIndex ].ulObject == ulObject )
+			{
+				pxEntry = &( xTraceRecorder.xObjects[ ulIndex ] );
+				break;
+			}
+		}
+
+		/* Otherwise entries are taken in order, the oldest one is reused when
+		the table is full. */
+		if( pxEntry == NULL )
+		{
+			pxEntry = &( xTraceRecorder.xObjects[ xTraceRecorder.xHeader.ulNextObject ] );
+			xTraceRecorder.xHeader.ulNextObject = ( xTraceRecorder.xHeader.ulNextObject + 1U ) % ( uint32_t ) configTRACE_RECORDER_MAX_OBJECTS;
+		}
+
+		pxEntry->ulObject = ulObject;
+		( void ) memset( pxEntry->pcName, 0x00, sizeof( pxEntry->pcName ) );
+		if( pcName != NULL )
+		{
+			( void ) strncpy( pxEntry->pcName, pcName, sizeof( pxEntry->pcName ) );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderUserEvent( const void *pvChannel, uint32_t ulValue )
+{
+	vTraceRecorderWrite( ( uint8_t ) eTraceUser, 0U, pvChannel, ulValue );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderWrite( uint8_t ucEvent, uint8_t ucFlags, const void *pvObject, uint32_t ulParam )
+{
+UBaseType_t uxSavedInterruptStatus;
+TraceRecord_t *pxRecord;
+uint64_t ullTimestamp;
+
+	/* Records are written with interrupts masked, so the events of tasks and
+	ISRs are stored in the order they happened and with monotonic
+	timestamps. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( xTraceRecorder.xHeader.ulEnabled != 0U )
+		{
+			if( xTraceRecorder.xHeader.ullTimestampFrequency == 0U )
+			{
+				xTraceRecorder.xHeader.ullTimestampFrequency = ullTraceRecorderGetTimestampFrequency();
+			}
+
+			ullTimestamp = ullTraceRecorderGetTimestamp();
+			if( xTimestampBaseSet == pdFALSE )
+			{
+				ullTimestampBase = ullTimestamp;
+				xTimestampBaseSet = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			ullTimestamp -= ullTimestampBase;
+			pxRecord = &( xTraceRecorder.xRecords[ xTraceRecorder.xHeader.ulHead & ( ( uint32_t ) configTRACE_RECORDER_BUFFER_LENGTH - 1U ) ] );
+			pxRecord->ulTimestampLow = ( uint32_t ) ullTimestamp;
+			pxRecord->usTimestampHigh = ( uint16_t ) ( ullTimestamp >> 32 );
+			pxRecord->ucEvent = ucEvent;
+			pxRecord->ucFlags = ucFlags;
+			pxRecord->ulObject = traceOBJECT_ID( pvObject );
+			pxRecord->ulParam = ulParam;
+			xTraceRecorder.xHeader.ulHead++;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+
+#endif /* configUSE_TRACE_RECORDER */
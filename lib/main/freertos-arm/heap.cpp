@@ -0,0 +1,317 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <freertos/FreeRTOS.h>
+#include <reent.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+
+    #if configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0
+        #include "platform/arena.hpp"
+    #endif
+
+namespace {
+
+    #if configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0
+/// Size of the header stored in front of every C library allocation served from the arena.
+constexpr std::size_t cArenaHeaderSize = std::max<std::size_t>(portBYTE_ALIGNMENT, sizeof(std::size_t));
+
+/// Returns size stored in the header of the C library allocation served from the arena.
+/// @param ptr              Memory allocated from the arena.
+std::size_t& arenaBlockSize(void* ptr)
+{
+    return *(static_cast<std::size_t*>(ptr) - 1);
+}
+
+/// Allocates memory from the arena bound to the calling task.
+/// @param size             Number of bytes to be allocated.
+/// @param alignment        Alignment of the memory.
+/// @return Pointer to the memory or nullptr if the task has no arena or it is exhausted.
+void* arenaAllocate(std::size_t size, std::size_t alignment = portBYTE_ALIGNMENT)
+{
+    auto* arena = platform::currentArena();
+    if (arena == nullptr)
+        return nullptr;
+
+    auto headerSize = std::max(cArenaHeaderSize, alignment);
+    auto* block = static_cast<std::byte*>(arena->allocate(headerSize + size, alignment));
+    if (block == nullptr)
+        return nullptr;
+
+    void* ptr = block + headerSize;
+    arenaBlockSize(ptr) = size;
+    return ptr;
+}
+
+/// Checks if the memory was allocated from the arena bound to the calling task.
+/// @param ptr              Memory to be checked.
+bool arenaContains(void* ptr)
+{
+    auto* arena = platform::currentArena();
+    return arena != nullptr && arena->contains(ptr);
+}
+
+/// Resizes memory allocated from the arena in place.
+/// @param ptr              Memory allocated from the arena.
+/// @param size             Requested size.
+/// @return True if the memory was resized, false otherwise.
+bool arenaResize(void* ptr, std::size_t size)
+{
+    if (!platform::currentArena()->resize(ptr, arenaBlockSize(ptr), size))
+        return false;
+
+    arenaBlockSize(ptr) = size;
+    return true;
+}
+    #else
+void* arenaAllocate(std::size_t /*unused*/, std::size_t /*unused*/ = portBYTE_ALIGNMENT)
+{
+    return nullptr;
+}
+
+bool arenaContains(void* /*unused*/)
+{
+    return false;
+}
+
+std::size_t arenaBlockSize(void* /*unused*/)
+{
+    return 0;
+}
+
+bool arenaResize(void* /*unused*/, std::size_t /*unused*/)
+{
+    return false;
+}
+    #endif
+
+/// Header stored in front of C library allocations aligned beyond portBYTE_ALIGNMENT, which are served from a larger
+/// FreeRTOS heap block.
+/// @note The check word takes the place of the last word of the FreeRTOS heap block header, which holds the block size
+/// (multiple of portBYTE_ALIGNMENT). The check word is the inverted address of the heap block, which is always odd, so
+/// aligned allocations can be told apart from the regular ones.
+struct AlignedHeader {
+    void* block;
+    std::uintptr_t check;
+};
+
+/// Returns the header of the C library allocation, which is valid only if the allocation is aligned.
+/// @param ptr              Memory allocated from the FreeRTOS heap.
+AlignedHeader& alignedHeader(void* ptr)
+{
+    return *(static_cast<AlignedHeader*>(ptr) - 1);
+}
+
+/// Checks if the C library allocation was aligned beyond portBYTE_ALIGNMENT.
+/// @param ptr              Memory allocated from the FreeRTOS heap.
+bool isAligned(void* ptr)
+{
+    const auto& header = alignedHeader(ptr);
+    auto address = reinterpret_cast<std::uintptr_t>(header.block); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return header.check == ~address;
+}
+
+/// Allocates memory from the FreeRTOS heap with alignment larger than portBYTE_ALIGNMENT.
+/// @param size             Number of bytes to be allocated.
+/// @param alignment        Alignment of the memory (power of two).
+/// @return Pointer to the memory or nullptr if the heap is exhausted.
+/// @note Block is over-allocated, so that the aligned memory and its header fit into it.
+void* heapAllocateAligned(std::size_t size, std::size_t alignment)
+{
+    if (size > SIZE_MAX - alignment - sizeof(AlignedHeader))
+        return nullptr;
+
+    auto* block = static_cast<std::byte*>(pvPortMalloc(size + alignment + sizeof(AlignedHeader)));
+    if (block == nullptr)
+        return nullptr;
+
+    auto address = reinterpret_cast<std::uintptr_t>(block); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto offset = ((address + sizeof(AlignedHeader) + alignment - 1) & ~(alignment - 1)) - address;
+    void* ptr = block + offset;
+    alignedHeader(ptr) = {block, ~address};
+    return ptr;
+}
+
+/// Frees memory allocated from the FreeRTOS heap by the C library allocation functions.
+/// @param ptr              Memory to be freed.
+void heapFree(void* ptr)
+{
+    vPortFree(isAligned(ptr) ? alignedHeader(ptr).block : ptr);
+}
+
+/// Returns number of bytes usable by the C library allocation from the FreeRTOS heap.
+/// @param ptr              Memory allocated from the FreeRTOS heap.
+std::size_t heapUsableSize(void* ptr)
+{
+    if (!isAligned(ptr))
+        return xPortGetUsableSize(ptr);
+
+    auto* block = static_cast<std::byte*>(alignedHeader(ptr).block);
+    return xPortGetUsableSize(block) - static_cast<std::size_t>(static_cast<std::byte*>(ptr) - block);
+}
+
+} // namespace
+
+extern "C" {
+
+/// Boundaries of the heap regions, defined in the linker script.
+/// @note All symbols are weak and resolve to nullptr if linker script doesn't provide them, so applications with older
+/// linker scripts still link. CCM region is optional, but without the main heap section the heap asserts on first use.
+extern std::uint8_t heapMin __attribute__((weak));
+extern std::uint8_t heapMax __attribute__((weak));
+extern std::uint8_t ccmHeapMin __attribute__((weak));
+extern std::uint8_t ccmHeapMax __attribute__((weak));
+
+/// Provides heap regions to the FreeRTOS heap on the first call to pvPortMalloc().
+/// @param ppxHeapRegions   Output parameter for the array of heap regions terminated with zero sized region.
+/// @note Main SRAM heap section is always used. CCM-RAM region is added only if linker script provides it.
+void vApplicationGetHeapRegions(const HeapRegion_t** ppxHeapRegions)
+{
+    static std::array<HeapRegion_t, 3> regions{};
+    std::size_t count = 0;
+
+    auto heapStart = reinterpret_cast<std::uintptr_t>(&heapMin); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto heapEnd = reinterpret_cast<std::uintptr_t>(&heapMax);   // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (heapStart != 0 && heapEnd > heapStart)
+        regions.at(count++) = {&heapMin, heapEnd - heapStart};
+
+    auto ccmMin = reinterpret_cast<std::uintptr_t>(&ccmHeapMin); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto ccmMax = reinterpret_cast<std::uintptr_t>(&ccmHeapMax); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (ccmMin != 0 && ccmMax > ccmMin)
+        regions.at(count++) = {&ccmHeapMin, ccmMax - ccmMin};
+
+    // Linker script of the application has to define heapMin and heapMax around the heap section (see README.md).
+    configASSERT(count != 0);
+
+    regions.at(count) = {nullptr, 0};
+    *ppxHeapRegions = regions.data();
+}
+
+// Newlib allocation functions are redirected to the FreeRTOS heap, so malloc(), new and the FreeRTOS objects share
+// one thread-safe heap instead of two separate ones. If the calling task has an arena bound (see platform/arena.hpp),
+// memory is taken from the arena first and freeing it is a no-op. Allocations with alignment larger than
+// portBYTE_ALIGNMENT (memalign(), aligned_alloc(), over-aligned new) are served from larger heap blocks.
+
+void* _malloc_r(struct _reent* reent, std::size_t size)
+{
+    void* ptr = arenaAllocate(size);
+    if (ptr == nullptr)
+        ptr = pvPortMalloc(size);
+
+    if (ptr == nullptr)
+        reent->_errno = ENOMEM;
+
+    return ptr;
+}
+
+void _free_r(struct _reent* /*unused*/, void* ptr)
+{
+    if (ptr != nullptr && !arenaContains(ptr))
+        heapFree(ptr);
+}
+
+void* _calloc_r(struct _reent* reent, std::size_t count, std::size_t size)
+{
+    if (size != 0 && count > SIZE_MAX / size) {
+        reent->_errno = ENOMEM;
+        return nullptr;
+    }
+
+    void* ptr = _malloc_r(reent, count * size);
+    if (ptr != nullptr)
+        std::memset(ptr, 0, count * size);
+
+    return ptr;
+}
+
+void* _realloc_r(struct _reent* reent, void* ptr, std::size_t size)
+{
+    if (ptr == nullptr)
+        return _malloc_r(reent, size);
+
+    if (size == 0) {
+        _free_r(reent, ptr);
+        return nullptr;
+    }
+
+    bool fromArena = arenaContains(ptr);
+    if (fromArena && arenaResize(ptr, size))
+        return ptr;
+
+    std::size_t usableSize = fromArena ? arenaBlockSize(ptr) : heapUsableSize(ptr);
+    if (size <= usableSize)
+        return ptr;
+
+    void* newPtr = _malloc_r(reent, size);
+    if (newPtr != nullptr) {
+        std::memcpy(newPtr, ptr, std::min(size, usableSize));
+        _free_r(reent, ptr);
+    }
+
+    return newPtr;
+}
+
+void* _memalign_r(struct _reent* reent, std::size_t alignment, std::size_t size)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        reent->_errno = EINVAL;
+        return nullptr;
+    }
+
+    if (void* ptr = arenaAllocate(size, std::max<std::size_t>(alignment, portBYTE_ALIGNMENT)))
+        return ptr;
+
+    // FreeRTOS heap blocks are aligned to portBYTE_ALIGNMENT, larger alignments need larger blocks.
+    if (alignment <= portBYTE_ALIGNMENT)
+        return _malloc_r(reent, size);
+
+    void* ptr = heapAllocateAligned(size, alignment);
+    if (ptr == nullptr)
+        reent->_errno = ENOMEM;
+
+    return ptr;
+}
+
+std::size_t _malloc_usable_size_r(struct _reent* /*unused*/, void* ptr)
+{
+    if (ptr == nullptr)
+        return 0;
+
+    return arenaContains(ptr) ? arenaBlockSize(ptr) : heapUsableSize(ptr);
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,218 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// Index of the FreeRTOS thread local storage pointer which holds the arena bound to the task.
+#ifndef configARENA_THREAD_LOCAL_STORAGE_INDEX
+    #define configARENA_THREAD_LOCAL_STORAGE_INDEX 0
+#endif
+
+static_assert(configARENA_THREAD_LOCAL_STORAGE_INDEX < configNUM_THREAD_LOCAL_STORAGE_POINTERS,
+              "Arenas require one FreeRTOS thread local storage pointer (configNUM_THREAD_LOCAL_STORAGE_POINTERS)");
+
+namespace platform {
+
+/// Bump allocator over a fixed buffer.
+/// @note Allocation only moves the top of the arena, so it takes constant time and needs no lock. Memory is not freed
+/// individually, but all at once with reset() or back to the point saved with mark().
+/// @note Arena is not thread-safe. It is meant to be used by a single task, e.g. for short-lived formatting and parsing
+/// buffers. See ArenaScope for binding the arena to the task.
+class Arena {
+public:
+    /// Position of the top of the arena, used to free everything allocated after it.
+    using Marker = std::size_t;
+
+    /// Constructor.
+    /// @param buffer           Memory used by the arena.
+    explicit Arena(std::span<std::byte> buffer)
+        : m_begin(buffer.data())
+        , m_capacity(buffer.size())
+    {}
+
+    Arena(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena& operator=(Arena&&) = delete;
+    ~Arena() = default;
+
+    /// Allocates memory from the arena.
+    /// @param size             Number of bytes to be allocated.
+    /// @param alignment        Alignment of the memory. Must be a power of two.
+    /// @return Pointer to the memory or nullptr if there is not enough space left.
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        auto begin = reinterpret_cast<std::uintptr_t>(m_begin); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto offset = ((begin + m_top + alignment - 1) & ~(alignment - 1)) - begin;
+        if (offset > m_capacity || size > m_capacity - offset)
+            return nullptr;
+
+        m_top = offset + size;
+        m_peak = std::max(m_peak, m_top);
+        return m_begin + offset;
+    }
+
+    /// Constructs an object in the memory allocated from the arena.
+    /// @param args             Arguments passed to the constructor of the object.
+    /// @return Pointer to the object or nullptr if there is not enough space left.
+    /// @note Destructors are never called, so only trivially destructible types are allowed.
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>);
+
+        void* memory = allocate(sizeof(T), alignof(T));
+        if (memory == nullptr)
+            return nullptr;
+
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /// Grows or shrinks the memory block in place.
+    /// @param block            Memory block allocated from this arena.
+    /// @param size             Current size of the block.
+    /// @param newSize          Requested size of the block.
+    /// @return True if the block was resized, false otherwise.
+    /// @note Only the most recently allocated block can be resized.
+    bool resize(void* block, std::size_t size, std::size_t newSize)
+    {
+        auto offset = static_cast<std::size_t>(static_cast<std::byte*>(block) - m_begin);
+        if (offset + size != m_top || newSize > m_capacity - offset)
+            return false;
+
+        m_top = offset + newSize;
+        m_peak = std::max(m_peak, m_top);
+        return true;
+    }
+
+    /// Returns the current top of the arena.
+    [[nodiscard]] Marker mark() const { return m_top; }
+
+    /// Frees all memory allocated after the given marker was taken.
+    /// @param marker           Marker returned by mark().
+    void rewind(Marker marker) { m_top = std::min(marker, m_top); }
+
+    /// Frees all memory allocated from the arena.
+    void reset() { m_top = 0; }
+
+    /// Checks if the pointer points into the arena.
+    /// @param pointer          Pointer to be checked.
+    [[nodiscard]] bool contains(const void* pointer) const
+    {
+        const auto* address = static_cast<const std::byte*>(pointer);
+        return address >= m_begin && address < m_begin + m_capacity;
+    }
+
+    /// Returns number of bytes currently allocated, including alignment padding.
+    [[nodiscard]] std::size_t used() const { return m_top; }
+
+    /// Returns the highest number of bytes ever allocated.
+    [[nodiscard]] std::size_t peak() const { return m_peak; }
+
+    /// Returns size of the arena.
+    [[nodiscard]] std::size_t capacity() const { return m_capacity; }
+
+private:
+    std::byte* m_begin;
+    std::size_t m_capacity;
+    std::size_t m_top{};
+    std::size_t m_peak{};
+};
+
+/// Arena with its own buffer sized at compile time.
+/// @tparam size            Size of the arena in bytes.
+template <std::size_t size>
+class StaticArena : public Arena {
+public:
+    /// Constructor.
+    StaticArena()
+        : Arena(m_storage)
+    {}
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, size> m_storage;
+};
+
+/// Returns arena bound to the calling task or nullptr if there is none.
+/// @note Must not be called from an interrupt.
+inline Arena* currentArena()
+{
+    auto* task = xTaskGetCurrentTaskHandle();
+    if (task == nullptr)
+        return nullptr;
+
+    return static_cast<Arena*>(pvTaskGetThreadLocalStoragePointer(task, configARENA_THREAD_LOCAL_STORAGE_INDEX));
+}
+
+/// Binds the arena to the calling task for the lifetime of the scope.
+/// @note While the arena is bound, C library allocations made by the task (malloc(), new, formatting functions, etc.)
+/// are served from the arena on targets where the C library supports it (newlib on freertos-arm). Such memory is
+/// released only by Arena::reset() or Arena::rewind(), and has to be freed or reallocated while the arena is still
+/// bound to the task.
+/// @note Some C library functions allocate long-lived buffers on first use (e.g. stdio buffers of the task's
+/// struct _reent). Use them at least once before the first scope, if the arena is going to be reset afterwards.
+class ArenaScope {
+public:
+    /// Constructor. Binds the arena to the calling task.
+    /// @param arena            Arena to be bound.
+    explicit ArenaScope(Arena& arena)
+        : m_previous(currentArena())
+    {
+        bind(&arena);
+    }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+
+    /// Destructor. Restores the arena bound to the task before the scope.
+    ~ArenaScope() { bind(m_previous); }
+
+private:
+    static void bind(Arena* arena)
+    {
+        vTaskSetThreadLocalStoragePointer(nullptr, configARENA_THREAD_LOCAL_STORAGE_INDEX, arena);
+    }
+
+    Arena* m_previous;
+};
+
+} // namespace platform
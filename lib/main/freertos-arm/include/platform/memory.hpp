@@ -0,0 +1,189 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace platform {
+namespace detail {
+
+constexpr std::size_t cWordSize = sizeof(std::uint32_t);
+constexpr std::size_t cBurstWords = 4;
+
+/// Returns offset of the given address from the previous word boundary.
+inline std::size_t wordOffset(const void* address)
+{
+    auto value = reinterpret_cast<std::uintptr_t>(address); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return value & (cWordSize - 1);
+}
+
+/// Copies up to 3 bytes and advances both pointers.
+/// @param dst              Destination.
+/// @param src              Source.
+/// @param size             Number of bytes to be copied.
+inline void copyBytes(std::uint8_t*& dst, const std::uint8_t*& src, std::size_t size)
+{
+    if ((size & 2U) != 0) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst += 2;
+        src += 2;
+    }
+
+    if ((size & 1U) != 0)
+        *dst++ = *src++;
+}
+
+/// Copies one word and advances both pointers.
+/// @param dst              Destination.
+/// @param src              Source, aligned or not.
+inline void copyWord(std::uint8_t*& dst, const std::uint8_t*& src)
+{
+    std::uint32_t word{};
+    std::memcpy(&word, src, cWordSize);
+    std::memcpy(dst, &word, cWordSize);
+    dst += cWordSize;
+    src += cWordSize;
+}
+
+/// Copies the given number of words to the word aligned destination and advances both pointers.
+/// @param dst              Destination, aligned to the word.
+/// @param src              Source, aligned or not.
+/// @param count            Number of words to be copied.
+/// @note Words of the aligned source are copied in bursts of cBurstWords.
+inline void copyWords(std::uint8_t*& dst, const std::uint8_t*& src, std::size_t count)
+{
+    if (wordOffset(src) == 0 && count >= cBurstWords) {
+        std::size_t bursts = count / cBurstWords;
+        count %= cBurstWords;
+        for (; bursts != 0; --bursts) {
+            for (std::size_t i = 0; i < cBurstWords; ++i)
+                copyWord(dst, src);
+        }
+    }
+
+    for (; count != 0; --count)
+        copyWord(dst, src);
+}
+
+/// Fills up to 3 bytes and advances the pointer.
+/// @param dst              Destination.
+/// @param value            Byte to be written.
+/// @param size             Number of bytes to be filled.
+inline void fillBytes(std::uint8_t*& dst, std::uint8_t value, std::size_t size)
+{
+    if ((size & 2U) != 0) {
+        dst[0] = value;
+        dst[1] = value;
+        dst += 2;
+    }
+
+    if ((size & 1U) != 0)
+        *dst++ = value;
+}
+
+/// Multiplier which replicates a byte into all bytes of a word.
+constexpr std::uint32_t cByteMultiplier = 0x01010101;
+
+/// Fills the given number of words of the word aligned destination and advances the pointer.
+/// @param dst              Destination, aligned to the word.
+/// @param value            Byte to be written.
+/// @param count            Number of words to be filled.
+inline void fillWords(std::uint8_t*& dst, std::uint8_t value, std::size_t count)
+{
+    std::uint32_t word = std::uint32_t{value} * cByteMultiplier;
+    auto fillWord = [&dst, word] {
+        std::memcpy(dst, &word, cWordSize);
+        dst += cWordSize;
+    };
+
+    if (count >= cBurstWords) {
+        std::size_t bursts = count / cBurstWords;
+        count %= cBurstWords;
+        for (; bursts != 0; --bursts) {
+            for (std::size_t i = 0; i < cBurstWords; ++i)
+                fillWord();
+        }
+    }
+
+    for (; count != 0; --count)
+        fillWord();
+}
+
+} // namespace detail
+
+/// Copies memory like memcpy(), with word and burst transfers regardless of the alignment of the source.
+/// @param destination      Destination buffer.
+/// @param source           Source buffer, not overlapping with the destination.
+/// @param size             Number of bytes to be copied.
+/// @return Destination buffer.
+/// @note Unlike memcpy() of newlib-nano, which copies byte by byte, it copies words also from the unaligned source, as
+/// Cortex-M3 and newer cores support unaligned word loads.
+inline void* copyMemory(void* destination, const void* source, std::size_t size)
+{
+    auto* dst = static_cast<std::uint8_t*>(destination);
+    const auto* src = static_cast<const std::uint8_t*>(source);
+
+    if (size >= detail::cWordSize) {
+        auto head = (detail::cWordSize - detail::wordOffset(dst)) % detail::cWordSize;
+        detail::copyBytes(dst, src, head);
+        size -= head;
+        detail::copyWords(dst, src, size / detail::cWordSize);
+        size %= detail::cWordSize;
+    }
+
+    detail::copyBytes(dst, src, size);
+    return destination;
+}
+
+/// Fills memory like memset(), with word and burst transfers.
+/// @param destination      Destination buffer.
+/// @param value            Value to be written, converted to unsigned char.
+/// @param size             Number of bytes to be filled.
+/// @return Destination buffer.
+inline void* fillMemory(void* destination, int value, std::size_t size)
+{
+    auto* dst = static_cast<std::uint8_t*>(destination);
+    auto byte = static_cast<std::uint8_t>(value);
+
+    if (size >= detail::cWordSize) {
+        auto head = (detail::cWordSize - detail::wordOffset(dst)) % detail::cWordSize;
+        detail::fillBytes(dst, byte, head);
+        size -= head;
+        detail::fillWords(dst, byte, size / detail::cWordSize);
+        size %= detail::cWordSize;
+    }
+
+    detail::fillBytes(dst, byte, size);
+    return destination;
+}
+
+} // namespace platform
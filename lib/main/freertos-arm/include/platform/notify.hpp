@@ -0,0 +1,321 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <cstdint>
+
+static_assert(configUSE_TASK_NOTIFICATIONS == 1, "Notification primitives require configUSE_TASK_NOTIFICATIONS set to 1");
+
+// Synchronization primitives built on direct to task notifications. Signalling a task directly avoids the queue lock,
+// the event lists and the item copy made by the queue based semaphores, at the cost of allowing only one waiting task.
+// Signalling section of the benchmark example compares them with the queue based ones. On the simulator, where the
+// cost is dominated by the critical sections (each is a host system call), uncontended lock and unlock pair of the
+// mutex is about 40% cheaper and waking up a waiting task about 25% cheaper, while non-blocking give and take pair
+// costs the same (both enter two critical sections).
+//
+// Each task has a single notification value, which is shared by all these primitives. A task can therefore wait on only
+// one of them at a time and must not use task notifications for anything else (including stream and message buffers,
+// which notify the waiting task internally).
+
+namespace platform {
+
+/// Binary semaphore, which can be taken only by the owner task.
+/// @note Semaphore is given with xTaskNotifyGive() and taken with ulTaskNotifyTake(), which clears the notification
+/// value, so multiple gives before a take are seen as one.
+class NotifySemaphore {
+public:
+    /// Constructor.
+    /// @param owner            Task which takes the semaphore. Can be set later with setOwner().
+    explicit NotifySemaphore(TaskHandle_t owner = nullptr)
+        : m_owner(owner)
+    {}
+
+    NotifySemaphore(const NotifySemaphore&) = delete;
+    NotifySemaphore(NotifySemaphore&&) = delete;
+    NotifySemaphore& operator=(const NotifySemaphore&) = delete;
+    NotifySemaphore& operator=(NotifySemaphore&&) = delete;
+    ~NotifySemaphore() = default;
+
+    /// Sets the task which takes the semaphore.
+    /// @param owner            Handle of the task.
+    void setOwner(TaskHandle_t owner) { m_owner = owner; }
+
+    /// Gives the semaphore.
+    void give()
+    {
+        configASSERT(m_owner != nullptr);
+        xTaskNotifyGive(m_owner);
+    }
+
+    /// Gives the semaphore in an interrupt.
+    /// @param higherPriorityTaskWoken  Set to pdTRUE if the owner task was unblocked and context switch should be
+    ///                                 requested before leaving the interrupt.
+    void giveFromIsr(BaseType_t* higherPriorityTaskWoken = nullptr)
+    {
+        configASSERT(m_owner != nullptr);
+        vTaskNotifyGiveFromISR(m_owner, higherPriorityTaskWoken);
+    }
+
+    /// Takes the semaphore. Can be called only by the owner task.
+    /// @param timeout          Maximal number of ticks to wait for the semaphore.
+    /// @return True if the semaphore was taken, false on timeout.
+    bool take(TickType_t timeout = portMAX_DELAY)
+    {
+        configASSERT(m_owner == xTaskGetCurrentTaskHandle());
+        return ulTaskNotifyTake(pdTRUE, timeout) != 0;
+    }
+
+private:
+    TaskHandle_t m_owner;
+};
+
+/// Counting semaphore, which can be taken only by the owner task.
+/// @note Each give increments the notification value and each take decrements it, so the count is limited only by the
+/// 32-bit notification value.
+class NotifyCountingSemaphore {
+public:
+    /// Constructor.
+    /// @param owner            Task which takes the semaphore. Can be set later with setOwner().
+    explicit NotifyCountingSemaphore(TaskHandle_t owner = nullptr)
+        : m_owner(owner)
+    {}
+
+    NotifyCountingSemaphore(const NotifyCountingSemaphore&) = delete;
+    NotifyCountingSemaphore(NotifyCountingSemaphore&&) = delete;
+    NotifyCountingSemaphore& operator=(const NotifyCountingSemaphore&) = delete;
+    NotifyCountingSemaphore& operator=(NotifyCountingSemaphore&&) = delete;
+    ~NotifyCountingSemaphore() = default;
+
+    /// Sets the task which takes the semaphore.
+    /// @param owner            Handle of the task.
+    void setOwner(TaskHandle_t owner) { m_owner = owner; }
+
+    /// Increments the count of the semaphore.
+    void give()
+    {
+        configASSERT(m_owner != nullptr);
+        xTaskNotifyGive(m_owner);
+    }
+
+    /// Increments the count of the semaphore in an interrupt.
+    /// @param higherPriorityTaskWoken  Set to pdTRUE if the owner task was unblocked and context switch should be
+    ///                                 requested before leaving the interrupt.
+    void giveFromIsr(BaseType_t* higherPriorityTaskWoken = nullptr)
+    {
+        configASSERT(m_owner != nullptr);
+        vTaskNotifyGiveFromISR(m_owner, higherPriorityTaskWoken);
+    }
+
+    /// Decrements the count of the semaphore. Can be called only by the owner task.
+    /// @param timeout          Maximal number of ticks to wait for the non-zero count.
+    /// @return True if the count was decremented, false on timeout.
+    bool take(TickType_t timeout = portMAX_DELAY)
+    {
+        configASSERT(m_owner == xTaskGetCurrentTaskHandle());
+        return ulTaskNotifyTake(pdFALSE, timeout) != 0;
+    }
+
+private:
+    TaskHandle_t m_owner;
+};
+
+/// Set of 32 event flags, which can be waited for only by the owner task.
+/// @note Flags are set in the notification value and collected by the owner task into its own copy, so flags which are
+/// not waited for are not lost.
+class NotifyEventFlags {
+public:
+    /// Constructor.
+    /// @param owner            Task which waits for the flags. Can be set later with setOwner().
+    explicit NotifyEventFlags(TaskHandle_t owner = nullptr)
+        : m_owner(owner)
+    {}
+
+    NotifyEventFlags(const NotifyEventFlags&) = delete;
+    NotifyEventFlags(NotifyEventFlags&&) = delete;
+    NotifyEventFlags& operator=(const NotifyEventFlags&) = delete;
+    NotifyEventFlags& operator=(NotifyEventFlags&&) = delete;
+    ~NotifyEventFlags() = default;
+
+    /// Sets the task which waits for the flags.
+    /// @param owner            Handle of the task.
+    void setOwner(TaskHandle_t owner) { m_owner = owner; }
+
+    /// Sets the flags.
+    /// @param flags            Flags to be set.
+    void set(std::uint32_t flags)
+    {
+        configASSERT(m_owner != nullptr);
+        xTaskNotify(m_owner, flags, eSetBits);
+    }
+
+    /// Sets the flags in an interrupt.
+    /// @param flags                    Flags to be set.
+    /// @param higherPriorityTaskWoken  Set to pdTRUE if the owner task was unblocked and context switch should be
+    ///                                 requested before leaving the interrupt.
+    void setFromIsr(std::uint32_t flags, BaseType_t* higherPriorityTaskWoken = nullptr)
+    {
+        configASSERT(m_owner != nullptr);
+        xTaskNotifyFromISR(m_owner, flags, eSetBits, higherPriorityTaskWoken);
+    }
+
+    /// Waits for the flags. Can be called only by the owner task.
+    /// @param flags            Flags to wait for.
+    /// @param waitForAll       True if all flags have to be set, false if any of them is enough.
+    /// @param clear            True if the awaited flags should be cleared before returning.
+    /// @param timeout          Maximal number of ticks to wait for the flags.
+    /// @return Value of all flags before they were cleared. The awaited flags are not set in it on timeout.
+    std::uint32_t wait(std::uint32_t flags, bool waitForAll, bool clear, TickType_t timeout = portMAX_DELAY)
+    {
+        configASSERT(m_owner == xTaskGetCurrentTaskHandle());
+
+        auto satisfied = [&] {
+            auto matched = m_flags & flags;
+            return waitForAll ? matched == flags : matched != 0;
+        };
+
+        TimeOut_t timeOut{};
+        vTaskSetTimeOutState(&timeOut);
+        collect(0);
+        while (!satisfied() && xTaskCheckForTimeOut(&timeOut, &timeout) == pdFALSE)
+            collect(timeout);
+
+        auto result = m_flags;
+        if (clear && satisfied())
+            m_flags &= ~flags;
+
+        return result;
+    }
+
+    /// Clears the flags. Can be called only by the owner task.
+    /// @param flags            Flags to be cleared.
+    void clear(std::uint32_t flags)
+    {
+        configASSERT(m_owner == xTaskGetCurrentTaskHandle());
+        collect(0);
+        m_flags &= ~flags;
+    }
+
+private:
+    /// Moves the flags set in the notification value to the owner's copy.
+    /// @param timeout          Maximal number of ticks to wait for a notification.
+    void collect(TickType_t timeout)
+    {
+        constexpr std::uint32_t cAllFlags = 0xffffffff;
+
+        std::uint32_t received{};
+        if (xTaskNotifyWait(0, cAllFlags, &received, timeout) == pdTRUE)
+            m_flags |= received;
+    }
+
+    TaskHandle_t m_owner;
+    std::uint32_t m_flags{};
+};
+
+/// Mutex with at most one waiting task at a time, e.g. shared by a task and a single worker.
+/// @note Unlocking hands the mutex over directly to the waiting task and wakes it with a notification. There is no
+/// priority inheritance, so the mutex should be used only by tasks with the same priority or where the priority
+/// inversion is bounded otherwise. Use the queue based mutex when more tasks can wait or inheritance is required.
+class NotifyMutex {
+public:
+    NotifyMutex() = default;
+    NotifyMutex(const NotifyMutex&) = delete;
+    NotifyMutex(NotifyMutex&&) = delete;
+    NotifyMutex& operator=(const NotifyMutex&) = delete;
+    NotifyMutex& operator=(NotifyMutex&&) = delete;
+    ~NotifyMutex() = default;
+
+    /// Locks the mutex.
+    /// @param timeout          Maximal number of ticks to wait for the mutex.
+    /// @return True if the mutex was locked, false on timeout.
+    /// @note Notification value is shared with the other primitives, so a notification left pending by them can end
+    /// the wait before the mutex is handed over. Only the ownership set by unlock() is therefore taken as locked.
+    bool lock(TickType_t timeout = portMAX_DELAY)
+    {
+        auto* current = xTaskGetCurrentTaskHandle();
+
+        taskENTER_CRITICAL();
+        if (m_owner == nullptr) {
+            m_owner = current;
+            taskEXIT_CRITICAL();
+            return true;
+        }
+
+        configASSERT(m_owner != current && m_waiter == nullptr);
+        m_waiter = current;
+        taskEXIT_CRITICAL();
+
+        TimeOut_t timeOut{};
+        vTaskSetTimeOutState(&timeOut);
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, timeout);
+
+            // Mutex could have been handed over after the wait ended, but before the ownership was checked.
+            // Notification sent with it is then consumed, so it does not wake up the next wait.
+            taskENTER_CRITICAL();
+            if (m_owner == current) {
+                ulTaskNotifyTake(pdTRUE, 0);
+                taskEXIT_CRITICAL();
+                return true;
+            }
+
+            if (xTaskCheckForTimeOut(&timeOut, &timeout) != pdFALSE) {
+                m_waiter = nullptr;
+                taskEXIT_CRITICAL();
+                return false;
+            }
+
+            taskEXIT_CRITICAL();
+        }
+    }
+
+    /// Unlocks the mutex. Can be called only by the task which locked it.
+    void unlock()
+    {
+        taskENTER_CRITICAL();
+        configASSERT(m_owner == xTaskGetCurrentTaskHandle());
+        m_owner = m_waiter;
+        m_waiter = nullptr;
+        if (m_owner != nullptr)
+            xTaskNotifyGive(m_owner);
+
+        taskEXIT_CRITICAL();
+    }
+
+    /// Returns task which holds the mutex or nullptr if it is unlocked.
+    [[nodiscard]] TaskHandle_t owner() const { return m_owner; }
+
+private:
+    TaskHandle_t m_owner{};
+    TaskHandle_t m_waiter{};
+};
+
+} // namespace platform
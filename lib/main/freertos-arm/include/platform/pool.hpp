@@ -0,0 +1,183 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/block_pool.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace platform {
+
+/// Fixed-size block pool with storage sized at compile time.
+/// @tparam blockSize       Size of a single block in bytes.
+/// @tparam blockCount      Number of blocks in the pool.
+/// @note Blocks are allocated and freed in constant time, from tasks and interrupts. Task allocating from exhausted
+/// pool can wait until a block is freed. See block_pool.h for details.
+template <std::size_t blockSize, std::size_t blockCount>
+class BlockPool {
+    static_assert(blockSize > 0 && blockCount > 0);
+
+public:
+    /// Constructor. Creates the pool in the object's own storage.
+    BlockPool()
+        : m_handle(xBlockPoolCreateStatic(blockSize, blockCount, m_storage.data(), &m_buffer))
+    {}
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool(BlockPool&&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+    BlockPool& operator=(BlockPool&&) = delete;
+
+    /// Destructor. Deletes the pool.
+    /// @note All blocks have to be returned to the pool before.
+    ~BlockPool() { vBlockPoolDelete(m_handle); }
+
+    /// Allocates a block from the pool.
+    /// @param timeout          Maximal number of ticks to wait for a block if the pool is exhausted.
+    /// @return Pointer to the block or nullptr if no block was available before the timeout.
+    void* allocate(TickType_t timeout = 0) { return pvBlockPoolAllocate(m_handle, timeout); }
+
+    /// Allocates a block from the pool in an interrupt.
+    /// @return Pointer to the block or nullptr if the pool is exhausted.
+    void* allocateFromIsr() { return pvBlockPoolAllocateFromISR(m_handle); }
+
+    /// Returns the block to the pool.
+    /// @param block            Block allocated from this pool.
+    void free(void* block) { vBlockPoolFree(m_handle, block); }
+
+    /// Returns the block to the pool in an interrupt.
+    /// @param block                    Block allocated from this pool.
+    /// @param higherPriorityTaskWoken  Set to pdTRUE if a higher priority task was unblocked and context switch should
+    ///                                 be requested before leaving the interrupt.
+    void freeFromIsr(void* block, BaseType_t* higherPriorityTaskWoken = nullptr)
+    {
+        vBlockPoolFreeFromISR(m_handle, block, higherPriorityTaskWoken);
+    }
+
+    /// Returns number of free blocks in the pool.
+    [[nodiscard]] std::size_t available() const { return uxBlockPoolBlocksAvailable(m_handle); }
+
+    /// Returns statistics of the pool.
+    [[nodiscard]] BlockPoolStats_t stats() const
+    {
+        BlockPoolStats_t stats{};
+        vBlockPoolGetStats(m_handle, &stats);
+        return stats;
+    }
+
+    /// Returns FreeRTOS handle of the pool.
+    [[nodiscard]] BlockPoolHandle_t handle() const { return m_handle; }
+
+private:
+    static constexpr std::size_t cStorageSize = blockpoolSTORAGE_SIZE(blockSize, blockCount);
+
+    StaticBlockPool_t m_buffer{};
+    alignas(portBYTE_ALIGNMENT) std::array<std::uint8_t, cStorageSize> m_storage{};
+    BlockPoolHandle_t m_handle;
+};
+
+/// Pool of objects of the given type, built on top of the BlockPool.
+/// @tparam T               Type of the objects.
+/// @tparam objectCount     Number of objects in the pool.
+/// @note Objects are constructed when taken from the pool and destroyed when returned to it, so the pool can be used
+/// to recycle e.g. messages passed between tasks without using the heap.
+template <typename T, std::size_t objectCount>
+class ObjectPool {
+    static_assert(alignof(T) <= portBYTE_ALIGNMENT);
+
+public:
+    /// Deleter which returns the object to the pool it was created from.
+    class Deleter {
+    public:
+        /// Constructor.
+        /// @param pool         Pool from which the object was created.
+        explicit Deleter(ObjectPool* pool = nullptr)
+            : m_pool(pool)
+        {}
+
+        /// Returns the object to the pool.
+        /// @param object       Object to be returned.
+        void operator()(T* object) const { m_pool->destroy(object); }
+
+    private:
+        ObjectPool* m_pool;
+    };
+
+    /// Owning pointer to an object from the pool.
+    using Ptr = std::unique_ptr<T, Deleter>;
+
+    /// Takes a block from the pool and constructs the object in it.
+    /// @param timeout          Maximal number of ticks to wait for a free object if the pool is exhausted.
+    /// @param args             Arguments passed to the constructor of the object.
+    /// @return Pointer to the object or nullptr if no object was available before the timeout.
+    template <typename... Args>
+    T* create(TickType_t timeout, Args&&... args)
+    {
+        void* block = m_pool.allocate(timeout);
+        if (block == nullptr)
+            return nullptr;
+
+        return new (block) T(std::forward<Args>(args)...);
+    }
+
+    /// Same as create(), but returns an owning pointer, which returns the object to the pool when it goes out of scope.
+    template <typename... Args>
+    Ptr make(TickType_t timeout, Args&&... args)
+    {
+        return Ptr(create(timeout, std::forward<Args>(args)...), Deleter(this));
+    }
+
+    /// Destroys the object and returns its block to the pool.
+    /// @param object           Object created from this pool. Can be nullptr.
+    void destroy(T* object)
+    {
+        if (object == nullptr)
+            return;
+
+        object->~T();
+        m_pool.free(object);
+    }
+
+    /// Returns number of free objects in the pool.
+    [[nodiscard]] std::size_t available() const { return m_pool.available(); }
+
+    /// Returns statistics of the pool.
+    [[nodiscard]] BlockPoolStats_t stats() const { return m_pool.stats(); }
+
+private:
+    BlockPool<sizeof(T), objectCount> m_pool;
+};
+
+} // namespace platform
@@ -0,0 +1,76 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+
+#include <cstdint>
+
+namespace platform::power {
+
+/// Depth of the sleep entered by the idle task when the tick is suppressed (configUSE_TICKLESS_IDLE set to 2).
+enum class SleepDepth {
+    Skip,  ///< Keep the tick running and do not sleep.
+    Sleep, ///< Stop the core until the next task unblock time or any interrupt. Tick timer keeps counting.
+    Deep,  ///< Application specific low power mode, which stops the tick timer (see DeepSleepFunction).
+};
+
+/// Selects the sleep depth for the given idle time, e.g. depending on the wake-up latency of the low power modes or
+/// on the peripherals which are still active.
+/// @param idleTicks        Number of ticks until the next task unblocks.
+/// @return Depth of the sleep to be entered.
+/// @note Called from the idle task with the scheduler suspended, so it must not block.
+using SelectFunction = SleepDepth (*)(TickType_t idleTicks);
+
+/// Enters application specific low power mode (e.g. STOP mode with the wake-up programmed in a low power timer).
+/// @param idleTicks        Maximal time to sleep, in ticks.
+/// @return Number of complete ticks that elapsed during the sleep (not greater than idleTicks).
+/// @note Called with interrupts disabled and the tick timer stopped. It should return as soon as an interrupt is
+/// pending. Part of the tick period elapsed before the sleep is lost, so the time kept by the kernel is delayed by less
+/// than one tick per deep sleep.
+using DeepSleepFunction = TickType_t (*)(TickType_t idleTicks);
+
+/// Statistics of the tickless idle.
+struct Stats {
+    std::uint32_t sleeps{};          ///< Number of sleeps entered (including the deep ones).
+    std::uint32_t deepSleeps{};      ///< Number of deep sleeps entered.
+    std::uint32_t aborted{};         ///< Number of sleeps abandoned, because a task became ready in the meantime.
+    std::uint64_t suppressedTicks{}; ///< Number of tick interrupts avoided by sleeping.
+};
+
+/// Sets functions used to enter low power modes from the idle task.
+/// @param select           Function selecting the sleep depth. If not set, SleepDepth::Sleep is always used.
+/// @param deepSleep        Function entering the deep sleep. If not set, SleepDepth::Deep falls back to
+///                         SleepDepth::Sleep.
+void setSleepHooks(SelectFunction select, DeepSleepFunction deepSleep = nullptr);
+
+/// Returns statistics of the tickless idle.
+Stats stats();
+
+} // namespace platform::power
@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+static_assert(configUSE_CRITICAL_PROFILER == 1,
+              "Critical section profiler requires configUSE_CRITICAL_PROFILER set to 1");
+
+namespace platform::profiler {
+
+/// Number of buckets in the histogram of critical section durations.
+constexpr std::size_t cBuckets = configCRITICAL_PROFILER_BUCKETS;
+
+/// Maximal number of call sites tracked by the profiler.
+constexpr std::size_t cMaxSites = configCRITICAL_PROFILER_MAX_SITES;
+
+/// Statistics of the critical sections entered at a single call site.
+struct Site {
+    std::uint32_t address{};                                  ///< Address of the code entering the sections.
+    std::uint32_t count{};                                    ///< Number of sections entered at the site.
+    std::uint64_t maxNs{};                                    ///< Longest section.
+    std::uint64_t averageNs{};                                ///< Average duration of the sections.
+};
+
+/// Discards all data recorded by the profiler, e.g. to measure only the steady state of the application.
+inline void reset()
+{
+    vCriticalProfilerReset();
+}
+
+/// Critical section profiler data, collected at a single point in time.
+/// @note Profiler is stopped while its data is copied, so sections ending at that time are not recorded.
+/// @note Call site addresses can be translated to source lines with tools/critical-profiler.py or addr2line. On hosted
+/// platforms only the lower 32 bits of the addresses are kept.
+class Report {
+public:
+    /// Collects the profiler data.
+    void update()
+    {
+        auto enabled = xCriticalProfiler.xHeader.ulEnabled != 0;
+        vCriticalProfilerStop();
+        std::size_t size{};
+        std::memcpy(&m_data, pvCriticalProfilerGetData(&size), sizeof(m_data));
+        if (enabled)
+            vCriticalProfilerStart();
+
+        m_siteCount = 0;
+        for (std::size_t i = 0; i < cMaxSites; ++i) {
+            if (m_data.xSites[i].ulSite != 0)
+                m_order[m_siteCount++] = i;
+        }
+
+        auto byWorst = [this](std::size_t lhs, std::size_t rhs) {
+            return m_data.xSites[lhs].ulMaxDuration > m_data.xSites[rhs].ulMaxDuration;
+        };
+        std::sort(m_order.begin(), m_order.begin() + static_cast<std::ptrdiff_t>(m_siteCount), byWorst);
+    }
+
+    /// Returns number of recorded critical sections.
+    [[nodiscard]] std::uint32_t sections() const { return m_data.xHeader.ulSections; }
+
+    /// Returns number of sections not assigned to call sites, because the call site table was full.
+    [[nodiscard]] std::uint32_t missedSites() const { return m_data.xHeader.ulMissedSites; }
+
+    /// Returns duration of the longest critical section, i.e. the worst interrupt blocking time.
+    [[nodiscard]] std::uint64_t worstNs() const { return toNanoseconds(m_data.xHeader.ulMaxDuration); }
+
+    /// Returns address of the code entering the longest critical section.
+    [[nodiscard]] std::uint32_t worstSite() const { return m_data.xHeader.ulMaxSite; }
+
+    /// Returns number of sections counted in the given bucket of the duration histogram.
+    /// @param bucket           Index of the bucket.
+    [[nodiscard]] std::uint32_t histogram(std::size_t bucket) const { return m_data.ulHistogram[bucket]; }
+
+    /// Returns the upper (exclusive) limit of durations counted in the given bucket of the histogram.
+    /// @param bucket           Index of the bucket.
+    /// @return Limit in nanoseconds.
+    /// @note Limits grow by powers of two. The last bucket counts all durations above the limit of the previous one.
+    [[nodiscard]] std::uint64_t bucketLimitNs(std::size_t bucket) const
+    {
+        return toNanoseconds(std::uint64_t{1} << (configCRITICAL_PROFILER_BUCKET_SHIFT + bucket));
+    }
+
+    /// Returns number of call sites in the report.
+    [[nodiscard]] std::size_t size() const { return m_siteCount; }
+
+    /// Returns statistics of the given call site. Sites are sorted by their longest section, in descending order.
+    /// @param index            Index of the site in the report.
+    /// @return Statistics of the call site.
+    [[nodiscard]] Site operator[](std::size_t index) const
+    {
+        const auto& raw = m_data.xSites[m_order[index]];
+        Site site;
+        site.address = raw.ulSite;
+        site.count = raw.ulCount;
+        site.maxNs = toNanoseconds(raw.ulMaxDuration);
+        if (raw.ulCount != 0)
+            site.averageNs = toNanoseconds(raw.ullTotalDuration / raw.ulCount);
+
+        return site;
+    }
+
+private:
+    /// Converts timestamp units of the profiler to nanoseconds.
+    /// @param ticks            Number of timestamp units.
+    /// @return Number of nanoseconds.
+    [[nodiscard]] std::uint64_t toNanoseconds(std::uint64_t ticks) const
+    {
+        constexpr std::uint64_t cNsInSec = 1000000000;
+        auto hz = m_data.xHeader.ullTimestampFrequency;
+        if (hz == 0)
+            return 0;
+
+        return (ticks / hz) * cNsInSec + (ticks % hz) * cNsInSec / hz;
+    }
+
+    CriticalProfiler_t m_data{};
+    std::array<std::size_t, cMaxSites> m_order{};
+    std::size_t m_siteCount{};
+};
+
+} // namespace platform::profiler
@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <span>
+
+/// Enables the stack monitor, which samples stack usage of all tasks from the idle hook.
+#ifndef configUSE_STACK_MONITOR
+    #define configUSE_STACK_MONITOR 0
+#endif
+
+/// Maximal number of tasks tracked by the stack monitor, including the deleted ones not reported yet.
+#ifndef configSTACK_MONITOR_MAX_TASKS
+    #define configSTACK_MONITOR_MAX_TASKS 16
+#endif
+
+/// Minimal time between two samples taken from the idle hook, in milliseconds. Each sample checks one task.
+#ifndef configSTACK_MONITOR_PERIOD_MS
+    #define configSTACK_MONITOR_PERIOD_MS 100
+#endif
+
+/// Margin added to the measured stack usage when recommending the stack size, in percent.
+#ifndef configSTACK_MONITOR_MARGIN_PERCENT
+    #define configSTACK_MONITOR_MARGIN_PERCENT 25
+#endif
+
+namespace platform::stack {
+
+/// Stack usage of a single task.
+/// @note Sizes are in words (StackType_t), the same unit as the stack depth passed to xTaskCreate().
+struct TaskStack {
+    TaskHandle_t handle{};                              ///< Handle of the task.
+    std::array<char, configMAX_TASK_NAME_LEN> name{};   ///< Name of the task, kept after the task is deleted.
+    std::size_t size{};                                 ///< Size of the stack.
+    std::size_t used{};                                 ///< Highest stack usage seen so far.
+    bool deleted{};                                     ///< True if the task did not exist in the last sample.
+};
+
+/// Returns recommended size of the task stack: the highest usage seen so far increased by
+/// configSTACK_MONITOR_MARGIN_PERCENT and rounded up to the stack alignment.
+/// @param task             Stack usage of the task.
+/// @return Recommended size in words.
+/// @note Recommendation is only as good as the test run: the usage has to be measured on the paths which use the most
+/// stack (error handling, deepest call chains, interrupts nested on the task stack on cores without a separate
+/// interrupt stack).
+inline std::size_t recommendedSize(const TaskStack& task)
+{
+    constexpr std::size_t cPercent = 100;
+    constexpr std::size_t cAlignment = std::max<std::size_t>(portBYTE_ALIGNMENT / sizeof(StackType_t), 1);
+
+    auto size = task.used + ((task.used * configSTACK_MONITOR_MARGIN_PERCENT) + cPercent - 1) / cPercent;
+    return (size + cAlignment - 1) / cAlignment * cAlignment;
+}
+
+#if configUSE_STACK_MONITOR
+
+/// Samples stack usage of all tasks.
+/// @note Idle hook samples one task at a time (see sampleNext()). Call it explicitly before deleting a task, which may
+/// not have been sampled yet, or before reading the final results.
+/// @note Scheduler is suspended while all stacks are checked, so it should not be called periodically.
+/// @note Must not be called from an interrupt.
+void sample();
+
+/// Samples stack usage of the next task, in the order of uxTaskGetStackStats().
+/// @note It is called periodically from the idle hook (see configSTACK_MONITOR_PERIOD_MS), so the scheduler is
+/// suspended only for the time of checking a single stack. Tasks not found in a complete round are marked as deleted.
+/// Tasks changing their state during a round can be skipped in it, and are then marked deleted until the next one.
+/// @note Must not be called from an interrupt.
+void sampleNext();
+
+/// Copies stack usage of all tasks seen by the monitor, including the deleted ones.
+/// @param stacks           Array to be filled with the results.
+/// @return Number of filled entries.
+/// @note Records of the deleted tasks returned by this function can be reused for new tasks, when all
+/// configSTACK_MONITOR_MAX_TASKS records are used.
+std::size_t tasks(std::span<TaskStack> stacks);
+
+/// Returns number of tasks, which were not monitored in the last complete sampling round because all records were
+/// used by other tasks.
+/// @note Increase configSTACK_MONITOR_MAX_TASKS or call report() (or tasks()) to free records of deleted tasks.
+std::size_t unmonitored();
+
+/// Prints stack usage of all tasks seen by the monitor along with the recommended stack sizes.
+inline void report()
+{
+    std::array<TaskStack, configSTACK_MONITOR_MAX_TASKS> stacks{};
+    auto count = tasks(stacks);
+
+    std::size_t reclaimable = 0;
+    std::printf("Stack usage [words]:\n");
+    std::printf("    %-*s %10s %10s %12s\n", configMAX_TASK_NAME_LEN, "task", "size", "used", "recommended");
+    for (const auto& task : std::span(stacks).first(count)) {
+        auto recommended = recommendedSize(task);
+        std::printf("    %-*s %10lu %10lu %12lu%s\n",
+                    configMAX_TASK_NAME_LEN,
+                    task.name.data(),
+                    static_cast<unsigned long>(task.size),
+                    static_cast<unsigned long>(task.used),
+                    static_cast<unsigned long>(recommended),
+                    task.deleted ? " (deleted)" : "");
+        if (task.size > recommended)
+            reclaimable += task.size - recommended;
+    }
+
+    std::printf("Reclaimable stack memory: %lu bytes\n", static_cast<unsigned long>(reclaimable * sizeof(StackType_t)));
+
+    if (auto count = unmonitored(); count != 0)
+        std::printf("Tasks not monitored (increase configSTACK_MONITOR_MAX_TASKS): %lu\n",
+                    static_cast<unsigned long>(count));
+}
+
+#endif
+
+} // namespace platform::stack
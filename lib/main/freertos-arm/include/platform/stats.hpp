@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <platform/clock.hpp>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+static_assert(configGENERATE_RUN_TIME_STATS == 1, "Task statistics require configGENERATE_RUN_TIME_STATS set to 1");
+
+namespace platform::stats {
+
+/// Number of buckets in the histogram of task switch-in latencies.
+constexpr std::size_t cLatencyBuckets = configRUN_TIME_STATS_LATENCY_BUCKETS;
+
+/// Run time statistics of a single task.
+struct TaskStats {
+    TaskHandle_t handle{};                                    ///< Handle of the task.
+    const char* name{};                                       ///< Name of the task. Invalid once the task is deleted.
+    std::uint64_t runTimeNs{};                                ///< Time spent in the Running state.
+    float cpuUsage{};                                         ///< Share of the CPU time used by the task, in percent.
+    std::uint32_t switches{};                                 ///< Number of times the task was switched in.
+    std::uint64_t maxLatencyNs{};                             ///< Longest time from becoming ready to running.
+    std::array<std::uint32_t, cLatencyBuckets> latencies{};   ///< Histogram of times from becoming ready to running.
+    std::uint32_t fpuSwitches{};                              ///< Number of times switched out with the FPU context.
+};
+
+/// Returns the upper (exclusive) limit of latencies counted in the given bucket of TaskStats::latencies.
+/// @param bucket           Index of the bucket.
+/// @return Limit in nanoseconds.
+/// @note Limits grow by powers of two. The last bucket counts all latencies above the limit of the previous one.
+inline std::uint64_t latencyLimitNs(std::size_t bucket)
+{
+    return clock::toNanoseconds(taskLATENCY_BUCKET_LIMIT(bucket));
+}
+
+/// Run time statistics of all tasks in the system, collected at a single point in time.
+/// @tparam cMaxTasks       Maximal number of tasks in the system.
+/// @note Statistics are collected with the scheduler suspended and without inspecting the task stacks, so they can be
+/// collected periodically in production code.
+/// @note CPU usage is relative to the run time of all tasks present in the snapshot (including the idle task), i.e. to
+/// the time since the scheduler was started, excluding the time of deleted tasks.
+template <std::size_t cMaxTasks>
+class Snapshot {
+public:
+    /// Collects the statistics of all tasks.
+    /// @return True on success, false if there are more than cMaxTasks tasks in the system.
+    bool update()
+    {
+        m_count = uxTaskGetRunTimeStats(m_tasks.data(), m_tasks.size(), nullptr);
+        m_totalRunTime = 0;
+        for (std::size_t i = 0; i < m_count; ++i)
+            m_totalRunTime += m_tasks[i].ulRunTimeCounter;
+
+        return m_count != 0;
+    }
+
+    /// Returns number of tasks in the snapshot.
+    [[nodiscard]] std::size_t size() const { return m_count; }
+
+    /// Returns statistics of the given task.
+    /// @param index            Index of the task in the snapshot.
+    /// @return Statistics of the task.
+    [[nodiscard]] TaskStats operator[](std::size_t index) const
+    {
+        const auto& raw = m_tasks[index];
+        TaskStats stats;
+        stats.handle = raw.xHandle;
+        stats.name = raw.pcTaskName;
+        stats.runTimeNs = clock::toNanoseconds(raw.ulRunTimeCounter);
+        if (m_totalRunTime != 0)
+            stats.cpuUsage = static_cast<float>(raw.ulRunTimeCounter) * cPercent / static_cast<float>(m_totalRunTime);
+
+        stats.switches = raw.ulSwitchCount;
+        stats.maxLatencyNs = clock::toNanoseconds(raw.ulMaxLatency);
+        std::copy(std::begin(raw.ulLatencyHistogram), std::end(raw.ulLatencyHistogram), stats.latencies.begin());
+#if configUSE_TASK_FPU_CONTROL == 1
+        stats.fpuSwitches = raw.ulFPUSwitchCount;
+#endif
+        return stats;
+    }
+
+private:
+    static constexpr float cPercent = 100.0F;
+    std::array<TaskRunTimeStats_t, cMaxTasks> m_tasks{};
+    std::size_t m_count{};
+    std::uint64_t m_totalRunTime{};
+};
+
+} // namespace platform::stats
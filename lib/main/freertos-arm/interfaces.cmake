@@ -0,0 +1,19 @@
+# Optional FreeRTOS components of the main library (pools, arenas, stats, etc.), shared by freertos-arm and
+# freertos-linux platforms. Their headers live in one include directory and are header-only on top of the sources built
+# into platform-main, so one interface target serves all of them and each component name is an alias of it.
+add_library(platform-main-freertos INTERFACE EXCLUDE_FROM_ALL)
+
+target_include_directories(platform-main-freertos
+    INTERFACE
+        ${CMAKE_CURRENT_LIST_DIR}/include
+)
+
+target_link_libraries(platform-main-freertos
+    INTERFACE
+        freertos
+        platform::main
+)
+
+foreach (COMPONENT arena memory notify pool power profiler stack stats)
+    add_library(platform::main-${COMPONENT} ALIAS platform-main-freertos)
+endforeach ()
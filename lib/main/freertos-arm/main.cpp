@@ -29,6 +29,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <platform/main.hpp>
+#include <platform/stack.hpp>
 
 #include <array>
 #include <cstdint>
@@ -83,12 +84,31 @@ extern "C" void vApplicationGetTimerTaskMemory(StaticTask_t** ppxTimerTaskTCBBuf
 
 namespace {
 
+/// Exit code returned by the application.
+int appExitCode = EXIT_SUCCESS;
+
 /// Wrapper thread that will execute the main application code.
+/// @note When application returns, scheduler is stopped on ports which support it (portHAS_END_SCHEDULER, e.g. Linux
+/// simulator). This makes vTaskStartScheduler() return, so the application exit code can be returned from main().
+/// On other ports the wrapper thread is deleted and the remaining tasks keep running.
+/// @note When the stack monitor is enabled (configUSE_STACK_MONITOR), stack usage report is printed before the
+/// scheduler is stopped.
 void mainThread(void* /*unused*/)
 {
     static auto argv0 = std::to_array("appMain");
     std::array<char*, 1> appArgv = {argv0.data()};
-    appMain(static_cast<int>(appArgv.size()), appArgv.data());
+    appExitCode = appMain(static_cast<int>(appArgv.size()), appArgv.data());
+
+#if configUSE_STACK_MONITOR
+    platform::stack::sample();
+    platform::stack::report();
+#endif
+
+#if portHAS_END_SCHEDULER
+    vTaskEndScheduler();
+#else
+    vTaskDelete(nullptr);
+#endif
 }
 
 } // namespace
@@ -124,5 +144,5 @@ int main()
 #endif
 
     vTaskStartScheduler();
-    return EXIT_SUCCESS;
+    return appExitCode;
 }
@@ -0,0 +1,282 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/power.hpp"
+
+#include "systick.hpp"
+
+#include <platform/clock.hpp>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#if (configUSE_TICKLESS_IDLE == 2) && !PLATFORM_CLOCK_USE_SYSTICK
+    #include <signal.h>
+    #include <sys/time.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+platform::power::SelectFunction selectFunction{};
+platform::power::DeepSleepFunction deepSleepFunction{};
+
+/// Statistics of the tickless idle. Modified only by the idle task with interrupts disabled.
+platform::power::Stats sleepStats;
+
+} // namespace
+
+namespace platform::power {
+
+void setSleepHooks(SelectFunction select, DeepSleepFunction deepSleep)
+{
+    taskENTER_CRITICAL();
+    selectFunction = select;
+    deepSleepFunction = deepSleep;
+    taskEXIT_CRITICAL();
+}
+
+Stats stats()
+{
+    taskENTER_CRITICAL();
+    auto current = sleepStats;
+    taskEXIT_CRITICAL();
+    return current;
+}
+
+} // namespace platform::power
+
+#if configUSE_TICKLESS_IDLE == 2
+namespace {
+
+    #if PLATFORM_CLOCK_USE_SYSTICK
+namespace systick = platform::systick;
+
+/// Disables all interrupts. BASEPRI used by the kernel critical sections would also prevent the interrupts with low
+/// priority from waking up the core.
+void disableInterrupts()
+{
+    asm volatile("cpsid i" ::: "memory");
+    asm volatile("dsb");
+    asm volatile("isb");
+}
+
+/// Enables all interrupts. The interrupt which woke up the core is handled right after.
+void enableInterrupts()
+{
+    asm volatile("cpsie i" ::: "memory");
+}
+
+/// Returns true if the tick interrupt is pending.
+bool tickPending()
+{
+    return (systick::reg(systick::cIcsrAddress) & systick::cIcsrPendstset) != 0;
+}
+
+/// Returns number of SysTick counts in a single tick.
+std::uint32_t countsPerTick()
+{
+    return static_cast<std::uint32_t>(platform::clock::frequency() / configTICK_RATE_HZ);
+}
+
+/// Sleeps with SysTick reloaded to expire at the next task unblock time.
+/// @param idleTicks        Maximal time to sleep, in ticks.
+/// @return Number of complete ticks which elapsed, not including the tick which is pending after the wake-up.
+/// @note SysTick is reprogrammed before the interrupts are enabled again, so the interrupt which woke up the core
+/// already sees the correct time. The few counts spent with the timer stopped are lost.
+TickType_t enterSleep(TickType_t idleTicks)
+{
+    auto ticksPeriod = countsPerTick();
+    idleTicks = std::min<TickType_t>(idleTicks, systick::cSystRvrMax / ticksPeriod);
+
+    // Reading the control register clears COUNTFLAG, so after the wake-up it shows only the expiry of the sleep period.
+    auto control = systick::reg(systick::cSystCsrAddress) & ~(systick::cSystCsrEnable | systick::cSystCsrCountflag);
+    systick::setReg(systick::cSystCsrAddress, control);
+
+    // Timer is restarted from the reload value, so it expires at the tick boundary after idleTicks.
+    auto current = systick::reg(systick::cSystCvrAddress);
+    auto elapsed = (ticksPeriod - 1) - current;
+    auto reload = current + (ticksPeriod * (idleTicks - 1));
+    systick::sleepOffset = elapsed;
+    systick::setReg(systick::cSystRvrAddress, reload);
+    systick::setReg(systick::cSystCvrAddress, 0);
+    systick::setReg(systick::cSystCsrAddress, control | systick::cSystCsrEnable);
+
+    asm volatile("dsb" ::: "memory");
+    asm volatile("wfi");
+    asm volatile("isb");
+
+    systick::setReg(systick::cSystCsrAddress, control);
+    TickType_t completeTicks{};
+    if ((systick::reg(systick::cSystCsrAddress) & systick::cSystCsrCountflag) != 0) {
+        // Timer has expired and the tick interrupt is pending. Timer continues with the rest of the tick period, which
+        // has already started.
+        auto remaining = (ticksPeriod - 1) - (reload - systick::reg(systick::cSystCvrAddress));
+        systick::setReg(systick::cSystRvrAddress, std::min(remaining, ticksPeriod - 1));
+        completeTicks = idleTicks - 1;
+    }
+    else {
+        // Other interrupt has woken up the core. Timer continues with the rest of the current tick period.
+        auto counted = elapsed + (reload - systick::reg(systick::cSystCvrAddress));
+        systick::setReg(systick::cSystRvrAddress, (ticksPeriod - 1) - (counted % ticksPeriod));
+        completeTicks = counted / ticksPeriod;
+    }
+
+    // Writing the current value register reloads the timer on the next count, so the reload value for the single tick
+    // period can be set right after it is started.
+    systick::setReg(systick::cSystCvrAddress, 0);
+    systick::setReg(systick::cSystCsrAddress, control | systick::cSystCsrEnable);
+    systick::setReg(systick::cSystRvrAddress, ticksPeriod - 1);
+    systick::sleepOffset = 0;
+    return completeTicks;
+}
+
+/// Sleeps in the application specific low power mode with SysTick stopped.
+/// @param idleTicks        Maximal time to sleep, in ticks.
+/// @return Number of complete ticks which elapsed.
+TickType_t enterDeepSleep(TickType_t idleTicks)
+{
+    auto control = systick::reg(systick::cSystCsrAddress) & ~(systick::cSystCsrEnable | systick::cSystCsrCountflag);
+    systick::setReg(systick::cSystCsrAddress, control);
+
+    auto completeTicks = std::min(deepSleepFunction(idleTicks), idleTicks);
+
+    // Part of the tick period elapsed before the sleep is unknown now, so the tick period starts from the beginning.
+    auto ticksPeriod = countsPerTick();
+    systick::setReg(systick::cSystRvrAddress, ticksPeriod - 1);
+    systick::setReg(systick::cSystCvrAddress, 0);
+    systick::setReg(systick::cSystCsrAddress, control | systick::cSystCsrEnable);
+    return completeTicks;
+}
+    #elif defined(__linux__)
+// Simulator emulates the tick interrupt with a periodic interval timer (see portable/Linux/port.c).
+constexpr std::int64_t cUsInSec = 1000000;
+constexpr std::int64_t cTickPeriodUs = cUsInSec / configTICK_RATE_HZ;
+
+void disableInterrupts()
+{
+    portDISABLE_INTERRUPTS();
+}
+
+void enableInterrupts()
+{
+    portENABLE_INTERRUPTS();
+}
+
+bool tickPending()
+{
+    sigset_t pending{};
+    sigpending(&pending);
+    return sigismember(&pending, portTICK_SIGNAL) == 1;
+}
+
+/// Sleeps with the interval timer expiring at the next task unblock time.
+/// @param idleTicks        Maximal time to sleep, in ticks.
+/// @return Number of complete ticks which elapsed, not including the tick handled during the sleep.
+/// @note Interval of the timer is not changed, so the ticks after the wake-up keep the phase from before the sleep.
+TickType_t enterSleep(TickType_t idleTicks)
+{
+    itimerval timer{};
+    getitimer(ITIMER_REAL, &timer);
+    auto sleepUs = (timer.it_value.tv_sec * cUsInSec) + timer.it_value.tv_usec;
+    sleepUs += static_cast<std::int64_t>(idleTicks - 1) * cTickPeriodUs;
+    timer.it_value.tv_sec = static_cast<time_t>(sleepUs / cUsInSec);
+    timer.it_value.tv_usec = static_cast<suseconds_t>(sleepUs % cUsInSec);
+    setitimer(ITIMER_REAL, &timer, nullptr);
+
+    // Scheduler is suspended, so the tick handled inside sigsuspend() is only pended by the kernel. Other host signals
+    // do not end the sleep.
+    sigset_t waitMask{};
+    pthread_sigmask(SIG_SETMASK, nullptr, &waitMask);
+    sigdelset(&waitMask, portTICK_SIGNAL);
+    auto start = ullTaskGetTickCount64();
+    while (ullTaskGetTickCount64() == start)
+        sigsuspend(&waitMask);
+
+    return idleTicks - 1;
+}
+
+/// Sleeps in the application specific low power mode with the interval timer stopped.
+/// @param idleTicks        Maximal time to sleep, in ticks.
+/// @return Number of complete ticks which elapsed.
+TickType_t enterDeepSleep(TickType_t idleTicks)
+{
+    itimerval stopped{};
+    itimerval timer{};
+    setitimer(ITIMER_REAL, &stopped, &timer);
+
+    auto completeTicks = std::min(deepSleepFunction(idleTicks), idleTicks);
+
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_REAL, &timer, nullptr);
+    return completeTicks;
+}
+    #else
+        #error "Tickless idle is not supported on this architecture"
+    #endif
+
+} // namespace
+
+/// Suppresses the tick and sleeps until the next task unblock time (or any interrupt).
+/// @param xExpectedIdleTime    Number of ticks until the next task unblocks.
+/// @note Called by the idle task with the scheduler suspended. Replaces the tickless idle of the portable layer
+/// (configUSE_TICKLESS_IDLE set to 1), so configPRE_SLEEP_PROCESSING() and configPOST_SLEEP_PROCESSING() are not used.
+extern "C" void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+    using platform::power::SleepDepth;
+
+    auto depth = (selectFunction != nullptr) ? selectFunction(xExpectedIdleTime) : SleepDepth::Sleep;
+    if (depth == SleepDepth::Skip)
+        return;
+
+    if (depth == SleepDepth::Deep && deepSleepFunction == nullptr)
+        depth = SleepDepth::Sleep;
+
+    disableInterrupts();
+
+    // Task could have become ready or the tick could have expired since the idle time was calculated.
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep || tickPending()) {
+        ++sleepStats.aborted;
+        enableInterrupts();
+        return;
+    }
+
+    auto completeTicks = (depth == SleepDepth::Deep) ? enterDeepSleep(xExpectedIdleTime)
+                                                         : enterSleep(xExpectedIdleTime);
+    vTaskStepTick(completeTicks);
+
+    ++sleepStats.sleeps;
+    if (depth == SleepDepth::Deep)
+        ++sleepStats.deepSleeps;
+
+    sleepStats.suppressedTicks += completeTicks;
+    enableInterrupts();
+}
+#endif
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/clock.hpp"
+
+#include <freertos/FreeRTOS.h>
+
+#include <cstdint>
+
+#if configUSE_CRITICAL_PROFILER
+
+    #if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M') && (__ARM_ARCH_ISA_THUMB == 2)
+        #define PLATFORM_PROFILER_USE_DWT 1
+    #elif defined(__arm__)
+        #error "Critical section profiler requires the DWT cycle counter of ARMv7-M or ARMv8-M mainline cores"
+    #else
+        #define PLATFORM_PROFILER_USE_DWT 0
+    #endif
+
+    #if PLATFORM_PROFILER_USE_DWT
+namespace {
+
+// Registers of the Data Watchpoint and Trace unit (ARMv7-M architecture reference manual, C1.8).
+constexpr std::uintptr_t cDemcrAddress = 0xe000edfc;
+constexpr std::uint32_t cDemcrTrcena = 1U << 24U;
+constexpr std::uintptr_t cDwtCtrlAddress = 0xe0001000;
+constexpr std::uint32_t cDwtCtrlCyccntena = 1U << 0U;
+constexpr std::uintptr_t cDwtCyccntAddress = 0xe0001004;
+constexpr std::uintptr_t cDwtLarAddress = 0xe0001fb0;
+constexpr std::uint32_t cDwtLarUnlockKey = 0xc5acce55;
+
+/// Returns reference to the memory mapped register.
+/// @param address          Address of the register.
+volatile std::uint32_t& reg(std::uintptr_t address)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return *reinterpret_cast<volatile std::uint32_t*>(address);
+}
+
+} // namespace
+    #endif
+
+extern "C" {
+
+// Sections are timed with the CPU cycle counter on Cortex-M. The platform clock cannot be used there, because it reads
+// the RTOS tick count in a critical section. The simulator uses the host monotonic clock, which does not.
+
+std::uint32_t ulCriticalProfilerGetTimestamp()
+{
+    #if PLATFORM_PROFILER_USE_DWT
+    // Called with interrupts masked. Only differences are used, so the counter is not reset when started.
+    static bool started{};
+    if (!started) {
+        reg(cDemcrAddress) = reg(cDemcrAddress) | cDemcrTrcena;
+        reg(cDwtLarAddress) = cDwtLarUnlockKey;
+        reg(cDwtCtrlAddress) = reg(cDwtCtrlAddress) | cDwtCtrlCyccntena;
+        started = true;
+    }
+
+    return reg(cDwtCyccntAddress);
+    #else
+    return static_cast<std::uint32_t>(platform::clock::ticks());
+    #endif
+}
+
+std::uint64_t ullCriticalProfilerGetTimestampFrequency()
+{
+    #if PLATFORM_PROFILER_USE_DWT
+    return configCPU_CLOCK_HZ;
+    #else
+    return platform::clock::frequency();
+    #endif
+}
+
+} // extern "C"
+
+#endif
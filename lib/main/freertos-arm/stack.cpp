@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/stack.hpp"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#if configUSE_STACK_MONITOR
+
+static_assert(configUSE_IDLE_HOOK == 1, "Stack monitor requires configUSE_IDLE_HOOK set to 1");
+static_assert(INCLUDE_uxTaskGetStackStats == 1, "Stack monitor requires INCLUDE_uxTaskGetStackStats set to 1");
+
+namespace {
+
+/// Stack usage of all tasks seen so far. Guarded by suspending the scheduler.
+std::array<platform::stack::TaskStack, configSTACK_MONITOR_MAX_TASKS> records;
+std::size_t recordCount{};
+
+/// Records of the tasks checked in the current round of sampleNext(). Guarded by suspending the scheduler.
+std::array<bool, configSTACK_MONITOR_MAX_TASKS> checked{};
+
+/// Records of the deleted tasks, which were already returned by tasks(). Guarded by suspending the scheduler.
+std::array<bool, configSTACK_MONITOR_MAX_TASKS> reported{};
+
+/// Number of tasks without a record in the current round of sampleNext() and in the last complete round (or sample()).
+/// Guarded by suspending the scheduler.
+std::size_t unmonitoredInRound{};
+std::size_t unmonitoredCount{};
+
+/// Finds record of the given task or creates a new one.
+/// @param stats            Stack statistics of the task returned by the kernel.
+/// @return Pointer to the record or nullptr if there is no space for a new one.
+/// @note Handle of a deleted task can be reused by a new task (e.g. created in the same static buffer), so records are
+/// matched also by the task name.
+/// @note When all records are used, record of a deleted task is reused once it has been reported by tasks().
+platform::stack::TaskStack* findRecord(const TaskStackStats_t& stats)
+{
+    std::string_view name(stats.pcTaskName);
+    auto used = std::span(records).first(recordCount);
+    auto it = std::ranges::find_if(used, [&](const auto& record) {
+        return record.handle == stats.xHandle && name == record.name.data();
+    });
+    if (it != used.end())
+        return &(*it);
+
+    std::size_t index = recordCount;
+    if (recordCount == records.size()) {
+        for (index = 0; index < recordCount; ++index) {
+            if (records.at(index).deleted && reported.at(index))
+                break;
+        }
+
+        if (index == recordCount)
+            return nullptr;
+    }
+    else {
+        ++recordCount;
+    }
+
+    auto& record = records.at(index);
+    record = {.handle = stats.xHandle};
+    std::ranges::copy(name.substr(0, record.name.size() - 1), record.name.begin());
+    return &record;
+}
+
+/// Updates the record of the task with its current stack usage.
+/// @param stats            Stack statistics of the task returned by the kernel.
+/// @return True if the task has a record, false if all records are used by other tasks.
+bool update(const TaskStackStats_t& stats)
+{
+    auto* record = findRecord(stats);
+    if (record == nullptr)
+        return false;
+
+    record->size = stats.usStackDepth;
+    record->used = std::max<std::size_t>(record->used, stats.usStackDepth - stats.usStackHighWaterMark);
+    record->deleted = false;
+    auto index = static_cast<std::size_t>(record - records.data());
+    checked.at(index) = true;
+    reported.at(index) = false;
+    return true;
+}
+
+} // namespace
+
+namespace platform::stack {
+
+void sample()
+{
+    // Idle task has a small stack, so the kernel results are kept in a static buffer.
+    static std::array<TaskStackStats_t, configSTACK_MONITOR_MAX_TASKS> current;
+
+    vTaskSuspendAll();
+    for (auto& record : std::span(records).first(recordCount))
+        record.deleted = true;
+
+    unmonitoredCount = 0;
+    auto count = uxTaskGetStackStats(current.data(), current.size());
+    if (count != 0) {
+        for (const auto& stats : std::span(current).first(count)) {
+            if (!update(stats))
+                ++unmonitoredCount;
+        }
+    }
+    else {
+        // There are more tasks than records, so they are checked one by one to count those without a record.
+        TaskStackStats_t stats{};
+        for (UBaseType_t i = 0; xTaskGetStackStatsByIndex(i, &stats) == pdPASS; ++i) {
+            if (!update(stats))
+                ++unmonitoredCount;
+        }
+    }
+    xTaskResumeAll();
+}
+
+void sampleNext()
+{
+    static UBaseType_t next{};
+
+    // Only the stack of one task is checked, so the scheduler is suspended for a short time even with many tasks.
+    TaskStackStats_t stats{};
+    vTaskSuspendAll();
+    if (xTaskGetStackStatsByIndex(next, &stats) == pdPASS) {
+        if (!update(stats))
+            ++unmonitoredInRound;
+
+        ++next;
+    }
+    else {
+        // Round is complete: tasks which were not found in it are gone.
+        for (std::size_t i = 0; i < recordCount; ++i) {
+            if (!checked.at(i))
+                records.at(i).deleted = true;
+        }
+
+        checked.fill(false);
+        unmonitoredCount = unmonitoredInRound;
+        unmonitoredInRound = 0;
+        next = 0;
+    }
+    xTaskResumeAll();
+}
+
+std::size_t tasks(std::span<TaskStack> stacks)
+{
+    vTaskSuspendAll();
+    auto count = std::min(stacks.size(), recordCount);
+    std::ranges::copy(std::span(records).first(count), stacks.begin());
+    for (std::size_t i = 0; i < count; ++i)
+        reported.at(i) = records.at(i).deleted;
+    xTaskResumeAll();
+    return count;
+}
+
+std::size_t unmonitored()
+{
+    vTaskSuspendAll();
+    auto count = unmonitoredCount;
+    xTaskResumeAll();
+    return count;
+}
+
+} // namespace platform::stack
+
+/// Samples stack usage of the next task every configSTACK_MONITOR_PERIOD_MS.
+/// @note Idle hook is owned by the platform when the stack monitor is enabled.
+extern "C" void vApplicationIdleHook()
+{
+    static TickType_t lastSample{};
+
+    auto now = xTaskGetTickCount();
+    if (now - lastSample < pdMS_TO_TICKS(configSTACK_MONITOR_PERIOD_MS))
+        return;
+
+    lastSample = now;
+    platform::stack::sampleNext();
+}
+
+#endif
@@ -27,12 +27,13 @@
 /////////////////////////////////////////////////////////////////////////////////////
 
 #include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
+#include <platform/clock.hpp>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
 
-#include <array>
+#include <cerrno>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -47,19 +48,33 @@ extern int consolePrint(const char* message, std::size_t size);
 
 extern "C" {
 
+/// Boundaries of the heap section, defined in the linker script.
+/// @note Symbols are weak and resolve to nullptr if linker script doesn't provide them, then this function always fails.
+extern char heapMin __attribute__((weak));
+extern char heapMax __attribute__((weak));
+
+/// Grows the newlib heap within the heap section defined in the linker script.
+/// @note When the FreeRTOS heap is built (PLATFORM_FREERTOS_HEAP) with dynamic allocation enabled, the heap section is
+/// owned by the FreeRTOS heap and newlib allocation functions are redirected to pvPortMalloc() (see heap.cpp). Then
+/// this function always fails, so that no other newlib code path can hand out the same memory.
 caddr_t _sbrk(intptr_t increment)
 {
-    constexpr int cBufferSize = 2 * 1024;
-    static std::array<char, cBufferSize> buffer;
-    static std::size_t offset = 0;
-
-    std::size_t prevOffset = offset;
-
-    if (offset + increment > buffer.size())
-        return nullptr;
+#if defined(PLATFORM_FREERTOS_HEAP) && configSUPPORT_DYNAMIC_ALLOCATION
+    constexpr bool cHeapOwnedByFreeRTOS = true;
+#else
+    constexpr bool cHeapOwnedByFreeRTOS = false;
+#endif
+    static char* current = &heapMin;
+
+    bool outOfHeap = current == nullptr || increment > &heapMax - current || increment < &heapMin - current;
+    if (cHeapOwnedByFreeRTOS || outOfHeap) {
+        errno = ENOMEM;
+        return reinterpret_cast<caddr_t>(-1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    }
 
-    offset += increment;
-    return static_cast<caddr_t>(&buffer.at(prevOffset));
+    char* prev = current;
+    current += increment;
+    return prev;
 }
 
 int _write(int /*unused*/, const void* buf, size_t count)
@@ -115,12 +130,10 @@ size_t fwrite(const void* ptr, size_t /*unused*/, size_t _n, FILE* /*unused*/)
 int _gettimeofday(struct timeval* tp, void* /*unused*/)
 {
     if (tp != nullptr) {
-        constexpr std::uint32_t cUsInMs = 1000;
-        constexpr std::uint32_t cUsInSec = 1000000;
-        auto nowUs = static_cast<std::uint32_t>(xTaskGetTickCount()) * cUsInMs;
-        auto nowSec = nowUs / cUsInSec;
-        tp->tv_usec = static_cast<suseconds_t>(nowUs - (nowSec * cUsInSec));
-        tp->tv_sec = nowSec;
+        constexpr std::int64_t cUsInSec = 1000000;
+        auto nowUs = std::chrono::duration_cast<std::chrono::microseconds>(platform::clock::now()).count();
+        tp->tv_sec = static_cast<time_t>(nowUs / cUsInSec);
+        tp->tv_usec = static_cast<suseconds_t>(nowUs % cUsInSec);
     }
 
     return 0;
@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    #define PLATFORM_CLOCK_USE_SYSTICK 1
+#else
+    #define PLATFORM_CLOCK_USE_SYSTICK 0
+#endif
+
+#if PLATFORM_CLOCK_USE_SYSTICK
+namespace platform::systick {
+
+// SysTick and interrupt control registers (ARMv7-M architecture reference manual, B3.3 and B3.2.4).
+constexpr std::uintptr_t cSystCsrAddress = 0xe000e010;
+constexpr std::uintptr_t cSystRvrAddress = 0xe000e014;
+constexpr std::uintptr_t cSystCvrAddress = 0xe000e018;
+constexpr std::uintptr_t cIcsrAddress = 0xe000ed04;
+constexpr std::uint32_t cSystCsrEnable = 1U << 0U;
+constexpr std::uint32_t cSystCsrCountflag = 1U << 16U;
+constexpr std::uint32_t cSystRvrMax = 0x00ffffff;
+constexpr std::uint32_t cIcsrPendstset = 1U << 26U;
+
+/// Returns value of the memory mapped register.
+/// @param address          Address of the register.
+inline std::uint32_t reg(std::uintptr_t address)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return *reinterpret_cast<volatile std::uint32_t*>(address);
+}
+
+/// Sets value of the memory mapped register.
+/// @param address          Address of the register.
+/// @param value            Value to be written.
+inline void setReg(std::uintptr_t address, std::uint32_t value)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    *reinterpret_cast<volatile std::uint32_t*>(address) = value;
+}
+
+/// Number of timer counts elapsed since the last tick, when SysTick was reloaded to count the whole tickless sleep.
+/// Zero when the timer counts single ticks. Modified only with interrupts disabled.
+inline std::uint32_t sleepOffset{};
+
+} // namespace platform::systick
+#endif
@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include <freertos/FreeRTOS.h>
+
+#include <array>
+#include <cstdint>
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+
+/// Provides heap region to the FreeRTOS heap on the first call to pvPortMalloc().
+/// @param ppxHeapRegions   Output parameter for the array of heap regions terminated with zero sized region.
+/// @note Simulator has no linker defined heap section, so a static buffer of configTOTAL_HEAP_SIZE bytes is used.
+/// Host C library keeps using its own malloc(), because it is also used by the threads backing the tasks.
+extern "C" void vApplicationGetHeapRegions(const HeapRegion_t** ppxHeapRegions)
+{
+    alignas(portBYTE_ALIGNMENT) static std::array<std::uint8_t, configTOTAL_HEAP_SIZE> heap;
+    static std::array<HeapRegion_t, 2> regions = {{{heap.data(), heap.size()}, {nullptr, 0}}};
+
+    *ppxHeapRegions = regions.data();
+}
+
+#endif
@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+namespace platform::clock {
+
+/// Returns current value of the monotonic counter, extended in software to 64 bits.
+/// @note Counter source depends on the platform:
+/// - Linux (and FreeRTOS simulator): clock_gettime(CLOCK_MONOTONIC_RAW) in nanoseconds,
+/// - baremetal ARM: DWT cycle counter (CYCCNT), started on the first call,
+/// - FreeRTOS ARM: RTOS tick count interpolated with the current value of the SysTick timer on Cortex-M, RTOS tick
+///   count only on other cores.
+/// @note Can be called from tasks and interrupts.
+/// @note On baremetal ARM, CYCCNT is only 32 bits wide and wraps every 2^32 / SystemCoreClock seconds (~25 s at
+/// 168 MHz). Wraps are detected between the calls, so this function has to be called at least once per wrap period
+/// (e.g. from a periodic interrupt). Otherwise the missed wraps are lost and the counter jumps back.
+/// @note On FreeRTOS ARM with SysTick, the tick interrupt (and interrupts preempting it) can see the timer already
+/// wrapped before the tick count is incremented. Counter is then held at the last returned value, so it never goes
+/// backwards, but it may stand still for a fraction of the tick period.
+std::uint64_t ticks();
+
+/// Returns frequency of the monotonic counter in Hz.
+std::uint64_t frequency();
+
+/// Converts number of counter ticks to nanoseconds.
+/// @param ticks            Number of counter ticks.
+/// @return Number of nanoseconds.
+inline std::uint64_t toNanoseconds(std::uint64_t ticks)
+{
+    constexpr std::uint64_t cNsInSec = 1000000000;
+    auto hz = frequency();
+    return (ticks / hz) * cNsInSec + (ticks % hz) * cNsInSec / hz;
+}
+
+/// Returns time elapsed since the start of the monotonic counter.
+inline std::chrono::nanoseconds now()
+{
+    return std::chrono::nanoseconds(toNanoseconds(ticks()));
+}
+
+/// Monotonic clock compatible with std::chrono, backed by the platform counter.
+/// @note Clock is steady only within the limits described in ticks() (on baremetal ARM it has to be read at least once
+/// per CYCCNT wrap period).
+struct SteadyClock {
+    using rep = std::int64_t;                                    // NOLINT(readability-identifier-naming)
+    using period = std::nano;                                    // NOLINT(readability-identifier-naming)
+    using duration = std::chrono::nanoseconds;                   // NOLINT(readability-identifier-naming)
+    using time_point = std::chrono::time_point<SteadyClock>;     // NOLINT(readability-identifier-naming)
+    static constexpr bool is_steady = true;                      // NOLINT(readability-identifier-naming)
+
+    /// Returns current time point.
+    static time_point now() noexcept { return time_point(clock::now()); }
+};
+
+} // namespace platform::clock
@@ -0,0 +1,52 @@
+/////////////////////////////////////////////////////////////////////////////////////
+///
+/// @file
+/// @author Kuba Sejdak
+/// @copyright MIT License
+///
+/// Copyright (c) 2026 Kuba Sejdak (kuba.sejdak@gmail.com)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/clock.hpp"
+
+#include <cstdint>
+#include <ctime>
+
+namespace platform::clock {
+
+std::uint64_t ticks()
+{
+    // CLOCK_MONOTONIC_RAW is not subject to NTP adjustments, so intervals measured with it are not distorted.
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+
+    constexpr std::uint64_t cNsInSec = 1000000000;
+    return static_cast<std::uint64_t>(now.tv_sec) * cNsInSec + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+std::uint64_t frequency()
+{
+    constexpr std::uint64_t cNsInSec = 1000000000;
+    return cNsInSec;
+}
+
+} // namespace platform::clock
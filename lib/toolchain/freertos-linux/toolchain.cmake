@@ -0,0 +1,11 @@
+if (NOT DEFINED CMAKE_TOOLCHAIN_FILE)
+    set(DEFAULT_TOOLCHAIN       gcc)
+
+    if (NOT DEFINED TOOLCHAIN)
+        message(STATUS "platform: 'TOOLCHAIN' is not defined. Using '${DEFAULT_TOOLCHAIN}'.")
+        set(TOOLCHAIN           ${DEFAULT_TOOLCHAIN})
+    endif ()
+
+    # FreeRTOS simulator is a regular Linux process, so it uses native Linux toolchains.
+    set(CMAKE_TOOLCHAIN_FILE    ${CMAKE_CURRENT_LIST_DIR}/../linux/${TOOLCHAIN}.cmake)
+endif ()
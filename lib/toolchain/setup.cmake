@@ -11,7 +11,7 @@ if (PLATFORM STREQUAL linux)
     set(OSAL_PLATFORM linux CACHE INTERNAL "")
 elseif (PLATFORM STREQUAL baremetal-arm)
     set(OSAL_PLATFORM none CACHE INTERNAL "")
-elseif (PLATFORM STREQUAL freertos-arm)
+elseif (PLATFORM STREQUAL freertos-arm OR PLATFORM STREQUAL freertos-linux)
     set(OSAL_PLATFORM freertos CACHE INTERNAL "")
 else ()
     message(FATAL_ERROR "platform: Unsupported platform: ${PLATFORM}")
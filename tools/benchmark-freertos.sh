@@ -0,0 +1,53 @@
+#!/bin/bash
+
+# Builds the FreeRTOS simulator benchmark example with each of the selectable kernel data structures and runs it.
+# Usage: tools/benchmark-freertos.sh [preset-name]
+
+set -e
+
+PRESET=${1:-linux-freertos-gcc-release}
+
+# Trace recorder and critical section profiler add overhead to every traced kernel operation and critical section, so
+# they are disabled in all benchmark builds.
+COMMON_FLAGS="-DconfigUSE_TRACE_RECORDER=0 -DconfigUSE_CRITICAL_PROFILER=0"
+
+declare -A VARIANTS=(
+    ["sorted-list"]="-DconfigUSE_TIMER_LIST_TIMING_WHEEL=0 -DconfigUSE_TIMER_LIST_HEAP=0"
+    ["timing-wheel"]="-DconfigUSE_TIMER_LIST_TIMING_WHEEL=1 -DconfigUSE_TIMER_LIST_HEAP=0"
+    ["heap"]="-DconfigUSE_TIMER_LIST_TIMING_WHEEL=0 -DconfigUSE_TIMER_LIST_HEAP=1"
+)
+
+for VARIANT in sorted-list timing-wheel heap; do
+    BUILD_DIR=out/build/benchmark-${VARIANT}
+    FLAGS="${COMMON_FLAGS} ${VARIANTS[${VARIANT}]}"
+
+    echo "=== ${VARIANT} ==="
+    cmake --preset "${PRESET}" -B "${BUILD_DIR}" -DAPP_C_FLAGS="${FLAGS}" -DAPP_CXX_FLAGS="${FLAGS}" > /dev/null
+    cmake --build "${BUILD_DIR}" --target platform-freertos-benchmark-example > /dev/null
+    "${BUILD_DIR}/bin/platform-freertos-benchmark-example"
+done
+
+# Context switch latency of the generic task selection grows with the distance between priorities, so both task
+# selections are measured for increasing number of configured priorities.
+for PRIORITIES in 8 16 32 64; do
+    for SELECTION in generic bitmap; do
+        BUILD_DIR=out/build/benchmark-${SELECTION}-${PRIORITIES}-priorities
+        BITMAP=$([ "${SELECTION}" = bitmap ] && echo 1 || echo 0)
+        FLAGS="${COMMON_FLAGS} -DconfigMAX_PRIORITIES=${PRIORITIES} -DconfigUSE_PRIORITY_BITMAP_TASK_SELECTION=${BITMAP}"
+
+        echo "=== ${SELECTION} task selection, ${PRIORITIES} priorities ==="
+        cmake --preset "${PRESET}" -B "${BUILD_DIR}" -DAPP_C_FLAGS="${FLAGS}" -DAPP_CXX_FLAGS="${FLAGS}" > /dev/null
+        cmake --build "${BUILD_DIR}" --target platform-freertos-benchmark-example > /dev/null
+        "${BUILD_DIR}/bin/platform-freertos-benchmark-example"
+    done
+done
+
+for HEAP in first_fit tlsf; do
+    BUILD_DIR=out/build/benchmark-${HEAP}-heap
+
+    echo "=== ${HEAP} heap ==="
+    cmake --preset "${PRESET}" -B "${BUILD_DIR}" -DFREERTOS_HEAP="${HEAP}" \
+        -DAPP_C_FLAGS="${COMMON_FLAGS}" -DAPP_CXX_FLAGS="${COMMON_FLAGS}" > /dev/null
+    cmake --build "${BUILD_DIR}" --target platform-freertos-benchmark-example > /dev/null
+    "${BUILD_DIR}/bin/platform-freertos-benchmark-example"
+done
@@ -0,0 +1,19 @@
+#!/bin/bash
+
+# Builds the log example, decodes its output with tools/log-decoder.py and compares it with the expected text.
+# Usage: tools/check-log-decoder.sh [preset-name]
+
+set -e -o pipefail
+
+PRESET=${1:-linux-native-gcc-debug}
+BUILD_DIR=out/build/log-decoder-${PRESET}
+EXPECTED=examples/log/expected-output.txt
+
+cmake --preset "${PRESET}" -B "${BUILD_DIR}" > /dev/null
+cmake --build "${BUILD_DIR}" --target platform-log-example > /dev/null
+
+# Example logs its argv[0], which depends on the build directory and platform, so it is replaced before comparison.
+"${BUILD_DIR}/bin/platform-log-example" \
+    | python3 tools/log-decoder.py "${BUILD_DIR}/bin/platform-log-example" \
+    | sed "s/argv\[0\] = '.*'/argv[0] = '<argv0>'/" \
+    | diff -u "${EXPECTED}" -
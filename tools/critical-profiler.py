@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+
+# Decodes a dump of the FreeRTOS critical section profiler (see lib/main/freertos-arm/freertos-10.2.1/include/freertos/
+# critical_profiler.h): prints the longest critical section, the histogram of section durations and the call sites
+# sorted by their longest section. The dump is the raw content of the xCriticalProfiler variable, written by the
+# application (see pvCriticalProfilerGetData()) or by the debugger (e.g. "dump binary value critical.bin
+# xCriticalProfiler" in gdb). When the ELF file of the application is given, call sites are translated with addr2line to
+# the functions (the outermost one for inlined code) and source lines that entered them. With --max-us the script fails
+# if the longest section exceeds the limit, so interrupt blocking time can be checked in regression tests.
+# Usage: tools/critical-profiler.py [--elf <elf-file>] [--addr2line <tool>] [--top <n>] [--max-us <limit>] <dump-file>
+
+import argparse
+import struct
+import subprocess
+import sys
+
+MAGIC = 0x50435246
+VERSION = 1
+HEADER = struct.Struct("<IHHHHIIIQIIIIII")
+SITE = struct.Struct("<IIIIQ")
+
+REFERENCE_SYMBOL = "vCriticalProfilerReset"
+SHT_SYMTAB = 2
+
+
+def load(path):
+    with open(path, "rb") as file:
+        data = file.read()
+
+    if len(data) < HEADER.size:
+        sys.exit(f"{path}: file too small for the critical section profiler header")
+
+    (magic, version, header_size, site_size, bucket_count, site_count, bucket_shift, _, frequency, reference, sections,
+     missed, max_duration, max_site, _) = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        sys.exit(f"{path}: not a critical section profiler dump (bad magic 0x{magic:08x})")
+    if version != VERSION:
+        sys.exit(f"{path}: unsupported critical section profiler version {version}")
+    if site_size != SITE.size:
+        sys.exit(f"{path}: unsupported call site size {site_size}")
+    if frequency == 0:
+        sys.exit(f"{path}: timestamp frequency is not set")
+    if len(data) < header_size + bucket_count * 4 + site_count * site_size:
+        sys.exit(f"{path}: file truncated")
+
+    histogram = list(struct.unpack_from(f"<{bucket_count}I", data, header_size))
+    sites = []
+    offset = header_size + bucket_count * 4
+    for index in range(site_count):
+        site, count, maximum, _, total = SITE.unpack_from(data, offset + index * site_size)
+        if site != 0:
+            sites.append((site, count, maximum, total))
+
+    return {
+        "frequency": frequency,
+        "reference": reference,
+        "bucket_shift": bucket_shift,
+        "sections": sections,
+        "missed": missed,
+        "max_duration": max_duration,
+        "max_site": max_site,
+        "histogram": histogram,
+        "sites": sites,
+    }
+
+
+def find_symbol(path, name):
+    with open(path, "rb") as file:
+        elf = file.read()
+
+    if elf[:4] != b"\x7fELF":
+        sys.exit(f"{path}: not an ELF file")
+
+    is64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, _ = struct.unpack_from(endian + "HHH", elf, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+        symbol = struct.Struct(endian + "IBBHQQ")
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, _ = struct.unpack_from(endian + "HHH", elf, 0x2E)
+        header = endian + "IIIIIIIIII"
+        symbol = struct.Struct(endian + "IIIBBH")
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    for section in sections:
+        if section[1] != SHT_SYMTAB:
+            continue
+
+        strings = sections[section[6]][4]
+        for offset in range(section[4], section[4] + section[5], symbol.size):
+            fields = symbol.unpack_from(elf, offset)
+            value = fields[4] if is64 else fields[1]
+            start = strings + fields[0]
+            if elf[start:elf.index(b"\0", start)].decode(errors="replace") == name:
+                return value
+
+    sys.exit(f"{path}: no {name} symbol (is the symbol table stripped?)")
+
+
+def locate(sites, elf, addr2line, reference):
+    # Sites are stored as return addresses, so the address of the call instruction is looked up. Only the lower 32 bits
+    # of the addresses are stored, so the load address of position independent executables is computed modulo 2^32.
+    bias = (reference - find_symbol(elf, REFERENCE_SYMBOL)) & 0xFFFFFFFF
+    addresses = [f"0x{(((site & ~1) - 1 - bias) & 0xFFFFFFFF):x}" for site in sites]
+    # Critical sections are entered through always inline wrappers, so with -i addr2line prints the whole inlining chain
+    # (innermost first) after each address marker (-a), and the outermost function is the one that entered the section.
+    try:
+        result = subprocess.run([addr2line, "-a", "-i", "-f", "-C", "-s", "-e", elf] + addresses, capture_output=True,
+                                text=True, check=True)
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit(f"{addr2line}: {error}")
+
+    frames = []
+    for line in result.stdout.splitlines():
+        if line.startswith("0x"):
+            frames.append([])
+        elif frames:
+            frames[-1].append(line)
+
+    return {site: f"{frame[-2]} ({frame[-1]})" for site, frame in zip(sites, frames) if len(frame) >= 2}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes FreeRTOS critical section profiler dump.")
+    parser.add_argument("--elf", help="ELF file of the application, to translate call sites to source lines")
+    parser.add_argument("--addr2line", default="addr2line", help="addr2line tool (e.g. arm-none-eabi-addr2line)")
+    parser.add_argument("--top", type=int, default=20, help="number of call sites to print (default: 20)")
+    parser.add_argument("--max-us", type=float, help="fail if the longest section exceeds the limit (microseconds)")
+    parser.add_argument("dump", help="binary dump of the xCriticalProfiler variable")
+    args = parser.parse_args()
+
+    profile = load(args.dump)
+    frequency = profile["frequency"]
+
+    def us(ticks):
+        return ticks * 1e6 / frequency
+
+    sites = sorted(profile["sites"], key=lambda item: item[2], reverse=True)[:args.top]
+    locations = {}
+    if args.elf:
+        locations = locate([profile["max_site"]] + [site[0] for site in sites], args.elf, args.addr2line,
+                           profile["reference"])
+
+    worst = us(profile["max_duration"])
+    print(f"Critical sections: {profile['sections']}, not assigned to call sites: {profile['missed']}")
+    print(f"Longest section: {worst:.3f} us at 0x{profile['max_site']:08x} {locations.get(profile['max_site'], '')}")
+
+    print("\nduration [us]        sections")
+    histogram = profile["histogram"]
+    for bucket, count in enumerate(histogram):
+        if bucket < len(histogram) - 1:
+            label = f"< {us(1 << (profile['bucket_shift'] + bucket)):.3f}"
+        else:
+            label = f">= {us(1 << (profile['bucket_shift'] + bucket - 1)):.3f}"
+        print(f"{label:<20} {count:8}")
+
+    print("\nsite           count    max [us]    avg [us]  location")
+    for site, count, maximum, total in sites:
+        average = us(total / count) if count else 0
+        print(f"0x{site:08x} {count:9} {us(maximum):11.3f} {average:11.3f}  {locations.get(site, '')}")
+
+    if args.max_us is not None and worst > args.max_us:
+        sys.exit(f"Longest critical section ({worst:.3f} us) exceeds the limit of {args.max_us:.3f} us")
+
+
+if __name__ == "__main__":
+    main()
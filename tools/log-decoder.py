@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+
+# Decodes binary log frames written by PLATFORM_LOG() (see lib/log/include/platform/log.hpp). Format strings are read
+# from the .platform_log section of the application ELF file. Regular text output is passed through unchanged.
+# Usage: tools/log-decoder.py [--location] <elf-file> [input-file]   (input is read from stdin by default)
+
+import argparse
+import re
+import struct
+import sys
+
+SECTION_NAME = ".platform_log"
+FRAME_START = 0x1E
+RECORD_SEPARATOR = "\x1f"
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d+))?"
+    r"(?:hh|h|ll|l|j|z|t|L)?(?P<type>[diouxXeEfFgGaAcsp%])"
+)
+
+
+def fnv1a(data):
+    value = FNV_OFFSET_BASIS
+    for byte in data:
+        value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def read_section(path, name):
+    with open(path, "rb") as file:
+        elf = file.read()
+
+    if elf[:4] != b"\x7fELF":
+        sys.exit(f"{path}: not an ELF file")
+
+    is64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2E)
+        header = endian + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+    for section in sections:
+        start = names_offset + section[0]
+        if elf[start:elf.index(b"\0", start)].decode() == name:
+            return elf[section[4]:section[4] + section[5]]
+
+    sys.exit(f"{path}: no {name} section (is platform::log linked and the section kept by the linker script?)")
+
+
+def load_messages(path):
+    messages = {}
+    for record in read_section(path, SECTION_NAME).split(b"\0"):
+        if not record:
+            continue
+
+        file, line, fmt = record.decode(errors="replace").split(RECORD_SEPARATOR, 2)
+        messages[fnv1a(record)] = (file, line, fmt)
+
+    return messages
+
+
+def read_arguments(payload):
+    arguments = []
+    position = 0
+    while position < len(payload):
+        tag = chr(payload[position])
+        position += 1
+        if tag == "s":
+            size = payload[position]
+            arguments.append(("s", payload[position + 1:position + 1 + size].decode(errors="replace")))
+            position += 1 + size
+            continue
+
+        layout = {"i": "<i", "u": "<I", "I": "<q", "U": "<Q", "f": "<f", "d": "<d"}.get(tag)
+        if layout is None:
+            break
+
+        value, = struct.unpack_from(layout, payload, position)
+        arguments.append((tag, value))
+        position += struct.calcsize(layout)
+
+    return arguments
+
+
+def format_message(fmt, arguments):
+    arguments = iter(arguments)
+
+    def next_value():
+        return next(arguments, ("i", 0))
+
+    def convert(match):
+        conversion = match.group("type")
+        if conversion == "%":
+            return "%"
+
+        width = match.group("width") or ""
+        if width == "*":
+            width = str(next_value()[1])
+
+        precision = match.group("precision")
+        if precision == "*":
+            precision = str(next_value()[1])
+
+        tag, value = next_value()
+        flags = match.group("flags")
+        if conversion in "diu":
+            conversion = "d"
+        elif conversion == "p":
+            conversion = "x"
+            flags += "#"
+        elif conversion in "aA":
+            return float(value).hex()
+
+        if conversion in "oxXd" and match.group("type") not in "di" and isinstance(value, int) and value < 0:
+            value += 1 << (32 if tag == "i" else 64)
+
+        if conversion in "oxXdc" and isinstance(value, float):
+            value = int(value)
+
+        spec = "%" + flags + width + ("." + precision if precision is not None else "") + conversion
+        try:
+            return spec % value
+        except (TypeError, ValueError, OverflowError):
+            return str(value)
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(stream, messages, location):
+    output = sys.stdout
+    text = bytearray()
+
+    def flush_text():
+        output.write(text.decode(errors="replace"))
+        output.flush()
+        text.clear()
+
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            break
+
+        if byte[0] != FRAME_START:
+            text += byte
+            if byte == b"\n":
+                flush_text()
+            continue
+
+        flush_text()
+        header = stream.read(1)
+        if not header:
+            break
+
+        payload = stream.read(header[0])
+        if len(payload) != header[0] or len(payload) < 4:
+            break
+
+        message_id, = struct.unpack_from("<I", payload)
+        message = messages.get(message_id)
+        if message is None:
+            output.write(f"<unknown log message 0x{message_id:08x}>\n")
+            continue
+
+        file, line, fmt = message
+        prefix = f"{file}:{line}: " if location else ""
+        output.write(prefix + format_message(fmt, read_arguments(payload[4:])) + "\n")
+        output.flush()
+
+    flush_text()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes binary log output of the platform::log component.")
+    parser.add_argument("--location", action="store_true", help="prefix each message with its file and line")
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", nargs="?", help="captured output (stdin if not given)")
+    args = parser.parse_args()
+
+    messages = load_messages(args.elf)
+    if args.input:
+        with open(args.input, "rb") as stream:
+            decode(stream, messages, args.location)
+    else:
+        decode(sys.stdin.buffer, messages, args.location)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+
+# Converts a dump of the FreeRTOS trace recorder (see lib/main/freertos-arm/freertos-10.2.1/include/freertos/
+# trace_recorder.h) to the Chrome trace event JSON format, which can be opened in Perfetto UI (https://ui.perfetto.dev)
+# or chrome://tracing. The dump is the raw content of the xTraceRecorder variable, written by the application (see
+# pvTraceRecorderGetData()) or by the debugger (e.g. "dump binary value trace.bin xTraceRecorder" in gdb).
+# Usage: tools/trace-converter.py [--summary] <dump-file> [output-file]   (output is written to stdout by default)
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x52545246
+VERSION = 1
+HEADER = struct.Struct("<IHHHHIIIQII")
+RECORD = struct.Struct("<IHBBII")
+
+FLAG_FROM_ISR = 0x01
+FLAG_FAILED = 0x02
+FLAG_READY = 0x04
+
+# Values of eTraceEvent.
+(
+    NONE,
+    TASK_SWITCHED_IN,
+    TASK_SWITCHED_OUT,
+    TASK_READY,
+    TASK_CREATE,
+    TASK_DELETE,
+    TASK_DELAY,
+    TASK_DELAY_UNTIL,
+    TASK_PRIORITY_SET,
+    TASK_PRIORITY_INHERIT,
+    TASK_PRIORITY_DISINHERIT,
+    TASK_SUSPEND,
+    TASK_RESUME,
+    TASK_NOTIFY,
+    TASK_NOTIFY_BLOCK,
+    TASK_NOTIFY_RECEIVE,
+    QUEUE_CREATE,
+    QUEUE_DELETE,
+    QUEUE_SEND,
+    QUEUE_RECEIVE,
+    QUEUE_PEEK,
+    QUEUE_BLOCK_SEND,
+    QUEUE_BLOCK_RECEIVE,
+    USER,
+) = range(24)
+
+# Queue types (ucQueueType), with the names of the send and receive operations.
+QUEUE_TYPES = {
+    0: ("queue", "send", "receive"),
+    1: ("mutex", "give", "take"),
+    2: ("counting semaphore", "give", "take"),
+    3: ("binary semaphore", "give", "take"),
+    4: ("recursive mutex", "give", "take"),
+}
+
+PID = 1
+ISR_TID = 0
+
+
+def load(path):
+    with open(path, "rb") as file:
+        data = file.read()
+
+    if len(data) < HEADER.size:
+        sys.exit(f"{path}: file too small for the trace recorder header")
+
+    (magic, version, header_size, object_size, record_size, object_count, record_count, head, frequency, _, _) = (
+        HEADER.unpack_from(data)
+    )
+    if magic != MAGIC:
+        sys.exit(f"{path}: not a trace recorder dump (bad magic 0x{magic:08x})")
+    if version != VERSION:
+        sys.exit(f"{path}: unsupported trace recorder version {version}")
+    if record_size != RECORD.size:
+        sys.exit(f"{path}: unsupported record size {record_size}")
+    if frequency == 0:
+        sys.exit(f"{path}: timestamp frequency not set")
+
+    records_offset = header_size + object_count * object_size
+    if len(data) < records_offset + record_count * record_size:
+        sys.exit(f"{path}: file truncated")
+
+    names = {}
+    for i in range(object_count):
+        offset = header_size + i * object_size
+        obj, = struct.unpack_from("<I", data, offset)
+        if obj != 0:
+            names[obj] = data[offset + 4:offset + object_size].split(b"\0")[0].decode(errors="replace")
+
+    def record(index):
+        return RECORD.unpack_from(data, records_offset + index * record_size)
+
+    # Until the ring is full, records are stored from the beginning. Afterwards the oldest one is at the head.
+    first = head % record_count
+    if head < record_count and record(first)[2] == NONE:
+        indexes = range(head)
+    else:
+        indexes = [(first + i) % record_count for i in range(record_count)]
+
+    # Timestamps are 48 bits wide, so they are extended across the wraps between consecutive records.
+    records = []
+    wraps = 0
+    previous = 0
+    for index in indexes:
+        low, high, event, flags, obj, param = record(index)
+        if event != NONE:
+            timestamp = (high << 32) | low
+            if timestamp < previous:
+                wraps += 1
+            previous = timestamp
+            records.append(((wraps << 48) | timestamp, event, flags, obj, param))
+
+    return names, frequency, records
+
+
+class Task:
+    def __init__(self, tid, name):
+        self.tid = tid
+        self.name = name
+        self.state = None
+        self.since = 0
+        self.pending = None
+        self.priority = None
+        self.running = 0
+        self.switches = 0
+        self.latencies = []
+
+
+class Converter:
+    def __init__(self, names, frequency, start):
+        self.names = names
+        self.frequency = frequency
+        self.start = start
+        self.events = []
+        self.tasks = {}
+        self.queues = {}
+        self.current = None
+        self.stats = {}
+        self.inheritances = 0
+
+    def name(self, obj):
+        return self.names.get(obj, f"0x{obj:08x}")
+
+    def us(self, timestamp):
+        return (timestamp - self.start) * 1e6 / self.frequency
+
+    def task(self, obj):
+        if obj not in self.tasks:
+            task = Task(len(self.tasks) + 1, self.name(obj))
+            self.tasks[obj] = task
+            self.events.append({"ph": "M", "pid": PID, "tid": task.tid, "name": "thread_name",
+                                "args": {"name": task.name}})
+        return self.tasks[obj]
+
+    def queue_type(self, obj):
+        return QUEUE_TYPES.get(self.queues.get(obj, 0), QUEUE_TYPES[0])
+
+    def set_state(self, task, state, timestamp):
+        if task.state is not None:
+            self.events.append({"ph": "X", "pid": PID, "tid": task.tid, "name": task.state, "cat": "state",
+                                "ts": self.us(task.since), "dur": self.us(timestamp) - self.us(task.since)})
+            if task.state == "Running":
+                task.running += timestamp - task.since
+            elif task.state in ("Ready", "Preempted") and state == "Running":
+                task.latencies.append(timestamp - task.since)
+
+        task.state = state
+        task.since = timestamp
+
+    def set_priority(self, task, priority, timestamp):
+        if task.priority != priority:
+            task.priority = priority
+            self.events.append({"ph": "C", "pid": PID, "name": f"{task.name} priority", "ts": self.us(timestamp),
+                                "args": {"priority": priority}})
+
+    def instant(self, name, flags, timestamp, args=None):
+        if flags & FLAG_FROM_ISR or self.current is None:
+            tid = ISR_TID
+        else:
+            tid = self.current.tid
+
+        event = {"ph": "i", "s": "t", "pid": PID, "tid": tid, "name": name, "ts": self.us(timestamp)}
+        if args:
+            event["args"] = args
+        self.events.append(event)
+
+    def queue_stats(self, obj):
+        return self.stats.setdefault(obj, {"send": 0, "receive": 0, "failed": 0, "blocked": 0})
+
+    def queue_operation(self, event, timestamp, flags, obj, items):
+        kind, send, receive = self.queue_type(obj)
+        operation = {QUEUE_SEND: send, QUEUE_RECEIVE: receive, QUEUE_PEEK: "peek"}[event]
+        failed = flags & FLAG_FAILED
+        name = f"{operation} {self.name(obj)}" + (" (failed)" if failed else "")
+        self.instant(name, flags, timestamp, {"items": items, "type": kind})
+
+        stats = self.queue_stats(obj)
+        if failed:
+            stats["failed"] += 1
+            return
+
+        if event == QUEUE_SEND:
+            stats["send"] += 1
+            items += 1
+        elif event == QUEUE_RECEIVE:
+            stats["receive"] += 1
+            items -= 1
+
+        self.events.append({"ph": "C", "pid": PID, "name": self.name(obj), "ts": self.us(timestamp),
+                            "args": {"items": items}})
+
+    def process(self, timestamp, event, flags, obj, param):
+        if event == TASK_SWITCHED_IN:
+            task = self.task(obj)
+            self.set_state(task, "Running", timestamp)
+            self.set_priority(task, param, timestamp)
+            task.switches += 1
+            self.current = task
+        elif event == TASK_SWITCHED_OUT:
+            task = self.task(obj)
+            if flags & FLAG_READY:
+                state = "Preempted"
+            else:
+                state = task.pending or "Blocked"
+            self.set_state(task, state, timestamp)
+            task.pending = None
+            self.current = None
+        elif event == TASK_READY:
+            task = self.task(obj)
+            if task is not self.current:
+                self.set_state(task, "Ready", timestamp)
+        elif event == TASK_CREATE:
+            task = self.task(obj)
+            self.set_priority(task, param, timestamp)
+            self.instant(f"create {task.name}", flags, timestamp)
+        elif event == TASK_DELETE:
+            task = self.task(obj)
+            self.set_state(task, None, timestamp)
+            self.instant(f"delete {task.name}", flags, timestamp)
+        elif event in (TASK_DELAY, TASK_DELAY_UNTIL):
+            self.task(obj).pending = "Delayed"
+        elif event == TASK_PRIORITY_SET:
+            self.set_priority(self.task(obj), param, timestamp)
+        elif event in (TASK_PRIORITY_INHERIT, TASK_PRIORITY_DISINHERIT):
+            task = self.task(obj)
+            inherit = event == TASK_PRIORITY_INHERIT
+            self.inheritances += inherit
+            self.instant(("inherit" if inherit else "disinherit") + f" priority {param} by {task.name}", flags,
+                         timestamp, {"holder": task.name, "from": task.priority, "to": param})
+            self.set_priority(task, param, timestamp)
+        elif event == TASK_SUSPEND:
+            task = self.task(obj)
+            if task is self.current:
+                task.pending = "Suspended"
+            else:
+                self.set_state(task, "Suspended", timestamp)
+        elif event == TASK_RESUME:
+            self.instant(f"resume {self.task(obj).name}", flags, timestamp)
+        elif event == TASK_NOTIFY:
+            self.instant(f"notify {self.task(obj).name}", flags, timestamp, {"value": param})
+        elif event == TASK_NOTIFY_BLOCK:
+            self.task(obj).pending = "Waiting for notification"
+        elif event == TASK_NOTIFY_RECEIVE:
+            self.instant("notification received", flags, timestamp, {"value": param})
+        elif event == QUEUE_CREATE:
+            self.queues[obj] = flags
+        elif event == QUEUE_DELETE:
+            self.instant(f"delete {self.name(obj)}", 0, timestamp)
+        elif event in (QUEUE_SEND, QUEUE_RECEIVE, QUEUE_PEEK):
+            self.queue_operation(event, timestamp, flags, obj, param)
+        elif event in (QUEUE_BLOCK_SEND, QUEUE_BLOCK_RECEIVE):
+            _, send, receive = self.queue_type(obj)
+            operation = send if event == QUEUE_BLOCK_SEND else receive
+            self.queue_stats(obj)["blocked"] += 1
+            if self.current is not None:
+                self.current.pending = f"Blocked on {self.name(obj)} ({operation})"
+        elif event == USER:
+            self.instant(self.name(obj), flags, timestamp, {"value": param})
+            self.events.append({"ph": "C", "pid": PID, "name": self.name(obj), "ts": self.us(timestamp),
+                                "args": {"value": param}})
+
+    def finish(self, timestamp):
+        for task in self.tasks.values():
+            self.set_state(task, None, timestamp)
+
+    def summary(self, output, duration):
+        output.write(f"Trace duration: {self.us(self.start + duration):.1f} us\n\n")
+        output.write("task                 running [%]  switches  max latency [us]  avg latency [us]\n")
+        for task in sorted(self.tasks.values(), key=lambda item: item.tid):
+            latencies = [latency * 1e6 / self.frequency for latency in task.latencies]
+            maximum = max(latencies, default=0)
+            average = sum(latencies) / len(latencies) if latencies else 0
+            running = 100 * task.running / duration if duration else 0
+            output.write(f"{task.name:<20} {running:11.1f}  {task.switches:8}  {maximum:16.1f}  {average:16.1f}\n")
+
+        output.write("\nqueue                type                  send/give  receive/take    failed   blocked\n")
+        for obj, stats in self.stats.items():
+            kind = self.queue_type(obj)[0]
+            output.write(f"{self.name(obj):<20} {kind:<20} {stats['send']:10}  {stats['receive']:12}  "
+                         f"{stats['failed']:8}  {stats['blocked']:8}\n")
+
+        output.write(f"\nPriority inheritances: {self.inheritances}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts FreeRTOS trace recorder dump to Chrome trace JSON.")
+    parser.add_argument("--summary", action="store_true", help="print task and queue statistics to stderr")
+    parser.add_argument("dump", help="binary dump of the xTraceRecorder variable")
+    parser.add_argument("output", nargs="?", help="output JSON file (stdout if not given)")
+    args = parser.parse_args()
+
+    names, frequency, records = load(args.dump)
+    if not records:
+        sys.exit(f"{args.dump}: no events recorded")
+
+    start = records[0][0]
+    end = records[-1][0]
+    converter = Converter(names, frequency, start)
+    converter.events.append({"ph": "M", "pid": PID, "name": "process_name", "args": {"name": "FreeRTOS"}})
+    converter.events.append({"ph": "M", "pid": PID, "tid": ISR_TID, "name": "thread_name",
+                             "args": {"name": "Interrupts"}})
+    for record in records:
+        converter.process(*record)
+    converter.finish(end)
+
+    trace = {"traceEvents": converter.events, "displayTimeUnit": "ns"}
+    if args.output:
+        with open(args.output, "w") as output:
+            json.dump(trace, output)
+    else:
+        json.dump(trace, sys.stdout)
+
+    if args.summary:
+        converter.summary(sys.stderr, end - start)
+
+
+if __name__ == "__main__":
+    main()